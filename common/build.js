@@ -28,24 +28,32 @@ const esbuild = require("esbuild");
 
 /*  Location of the C glue code, and the name of the C module.                */
 const cSrc = "./csrc/jstools/index.js";
-const cOut = "./dist/rjmthreetools.c.min.js";
+const cOut = "rjmthreetools.c";
 
 /*  Location of the Go glue code, and the name of the Go module.              */
 const goSrc = "./gosrc/jstools/index.js";
-const goOut = "./dist/rjmthreetools.go.min.js";
+const goOut = "rjmthreetools.go";
 
 /*  Location of the rust glue code, and the name of the rust module.          */
 const rustSrc = "./rustsrc/jstools/index.js";
-const rustOut = "./dist/rjmthreetools.rust.min.js";
+const rustOut = "rjmthreetools.rust";
 
-/*  Function for creating the min.js file for a given language.               */
+/*  Function for creating the min.js files for a given language.              */
 function build(wasmSource, output) {
 
     /*  Setup parameters for esbuild.                                         */
     const buildParameters = {
 
-        /*  Each language uses the same jscommon code.                        */
-        entryPoints: ["jscommon/index.js"],
+        /*  Each language uses the same jscommon code. The WebGPU functions   *
+         *  pull in three/webgpu and three/tsl, so they are a second entry,   *
+         *  rjmthreetools.c.webgpu.min.js for C, that only WebGPU figures     *
+         *  import. Code used by both, like three.js itself and the           *
+         *  WebAssembly module, is split into chunks shared by the two, so    *
+         *  there is one copy of each when a figure imports both.             */
+        entryPoints: {
+            [output]: "jscommon/index.js",
+            [output + ".webgpu"]: "jscommon/webgpu.js"
+        },
 
         /*  Package the ES module together.                                   */
         bundle: true,
@@ -53,15 +61,19 @@ function build(wasmSource, output) {
         /*  Shrink the file as much as possible.                              */
         minify: true,
 
-        /*  Location of the generated min.js file, in the dist directory.     */
-        outfile: output,
+        /*  The generated min.js files, and the chunks, go in dist.           */
+        outdir: "./dist",
+        outExtension: {".js": ".min.js"},
+        chunkNames: "chunks/[name]-[hash]",
+        splitting: true,
 
         /*  Output is an ES module.                                           */
         format: "esm",
 
         /*  The "main" module is provided by the individual animations. It is *
-         *  external and not part of the "common" directory.                  */
-        external: ["main"],
+         *  external and not part of the "common" directory. The same is true *
+         *  of the optional SIMD, threaded, and profiling variants.           */
+        external: ["main", "main-simd", "main-pthread", "main-profile"],
 
         /*  The location of "wasmtools" is dependent on the selected language.*/
         alias: {
@@ -0,0 +1,629 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Microbenchmarks for the threetools kernels, built natively with make  *
+ *      bench.                                                                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  clock_gettime and CLOCK_MONOTONIC need POSIX, request it before any       *
+ *  standard header is included.                                              */
+#define _POSIX_C_SOURCE 199309L
+
+/*  cosf and sinf found here.                                                 */
+#include <math.h>
+
+/*  printf and fprintf found here.                                            */
+#include <stdio.h>
+
+/*  strtod found here.                                                        */
+#include <stdlib.h>
+
+/*  strcmp, strncmp, and strstr found here.                                   */
+#include <string.h>
+
+/*  clock_gettime and struct timespec found here.                             */
+#include <time.h>
+
+/*  Function prototypes for the kernels being measured found here.            */
+#include <threetools/threetools.h>
+
+/*  store_line_segment, used by the baseline square wireframe, found here.    */
+#include <threetools/indices.h>
+
+/*  The kernels using the C++ templates, with the surface as a lambda.        */
+#include "template_kernels.h"
+
+/*  Number of elements in a fixed array.                                      */
+#define ARRAY_LENGTH(array) (sizeof(array) / sizeof((array)[0]))
+
+/*  A kernel being measured, called once per iteration.                       */
+typedef void (*BenchmarkKernel)(Canvas * const canvas);
+
+/*  A single benchmark. The canvas is created from the parameters before the  *
+ *  kernel is timed, and the kernel is called until it has run for at least   *
+ *  the minimum time.                                                         */
+typedef struct Benchmark {
+    const char *kernel_name;
+    BenchmarkKernel kernel;
+    CanvasParameters parameters;
+} Benchmark;
+
+/*  Options from the command line.                                            */
+typedef struct BenchmarkOptions {
+    const char *filter;
+    double min_time;
+    int csv;
+} BenchmarkOptions;
+
+/*  Grid sizes, the number of points along each axis.                         */
+static const unsigned int grid_sizes[] = {16U, 64U, 256U, 1024U};
+
+/*  Every mesh type, with the names used in the report.                       */
+static const MeshType mesh_types[] = {
+    SquareWireframe,
+    TriangleWireframe,
+    CylindricalSquareWireframe,
+    CylindricalTriangleWireframe,
+    MobiusSquareWireframe,
+    MobiusTriangleWireframe,
+    TorodialSquareWireframe,
+    TorodialTriangleWireframe,
+    KleinSquareWireframe,
+    KleinTriangleWireframe,
+    ProjectiveSquareWireframe,
+    ProjectiveTriangleWireframe
+};
+
+static const char * const mesh_type_names[] = {
+    "Square",
+    "Triangle",
+    "CylindricalSquare",
+    "CylindricalTriangle",
+    "MobiusSquare",
+    "MobiusTriangle",
+    "TorodialSquare",
+    "TorodialTriangle",
+    "KleinSquare",
+    "KleinTriangle",
+    "ProjectiveSquare",
+    "ProjectiveTriangle"
+};
+
+/*  The rotation applied by rotate_mesh, the same as in the animations.       */
+static const UnitVector rotation = {9.99987500E-01F, 4.99997917E-03F};
+
+/*  The curve used for generate_tube_mesh, a trefoil knot.                    */
+static Vec3 trefoil(float t)
+{
+    const Vec3 point = {
+        sinf(t) + 2.0F * sinf(2.0F * t),
+        cosf(t) - 2.0F * cosf(2.0F * t),
+        -sinf(3.0F * t)
+    };
+
+    return point;
+}
+
+/*  The same rotation as a 4x4 matrix for transform_mesh, column-major.       */
+static const Mat4 rotation_matrix = {{
+    9.99987500E-01F, 4.99997917E-03F, 0.0F, 0.0F,
+    -4.99997917E-03F, 9.99987500E-01F, 0.0F, 0.0F,
+    0.0F, 0.0F, 1.0F, 0.0F,
+    0.0F, 0.0F, 0.0F, 1.0F
+}};
+
+/*  The surface used for generate_parametric_mesh, an elliptic paraboloid.    */
+static float paraboloid(float x, float y)
+{
+    return x*x + 2.0F * y*y - 2.0F;
+}
+
+/*  The surface used for generate_surface_mesh, a torus with radii 2 and 1.   */
+static Vec3 torus(float u, float v)
+{
+    const float radius = 2.0F + cosf(v);
+    const Vec3 point = {radius * cosf(u), radius * sinf(u), sinf(v)};
+    return point;
+}
+
+/*  The same torus, written for generate_separable_surface_mesh.              */
+static Vec3 separable_torus(const AxisSample * const u,
+                            const AxisSample * const v)
+{
+    const float radius = 2.0F + v->cos_value;
+    const Vec3 point = {
+        radius * u->cos_value, radius * u->sin_value, v->sin_value
+    };
+
+    return point;
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      now                                                                   *
+ *  Purpose:                                                                  *
+ *      Returns the time from the monotonic clock, in seconds.                *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      time (double):                                                        *
+ *          The current time, from an unspecified starting point.             *
+ ******************************************************************************/
+static double now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double)time.tv_sec + 1.0E-9 * (double)time.tv_nsec;
+}
+/*  End of now.                                                               */
+
+/*  The kernels, wrapped to share the BenchmarkKernel signature.              */
+static void parametric_mesh_kernel(Canvas * const canvas)
+{
+    generate_parametric_mesh(canvas, paraboloid);
+}
+
+static void surface_mesh_kernel(Canvas * const canvas)
+{
+    generate_surface_mesh(canvas, torus);
+}
+
+static void separable_surface_mesh_kernel(Canvas * const canvas)
+{
+    generate_separable_surface_mesh(canvas, separable_torus);
+}
+
+static void tube_mesh_kernel(Canvas * const canvas)
+{
+    generate_tube_mesh(canvas, trefoil, 0.25F);
+}
+
+static void rectangular_wireframe_kernel(Canvas * const canvas)
+{
+    generate_rectangular_wireframe(canvas);
+}
+
+static void wireframe_kernel(Canvas * const canvas)
+{
+    generate_wireframe(canvas);
+}
+
+static void index_size_kernel(Canvas * const canvas)
+{
+    compute_index_size(canvas);
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      baseline_rectangular_wireframe                                        *
+ *  Purpose:                                                                  *
+ *      Generates the square wireframe the way generate_rectangular_wireframe *
+ *      did before store_rectangular_row, checking every vertex for the top   *
+ *      and right edges.                                                      *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being benchmarked.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is the baseline for the fused wireframe and for                  *
+ *      store_rectangular_row. It writes the same index buffer.               *
+ ******************************************************************************/
+static void baseline_rectangular_wireframe(Canvas * const canvas)
+{
+    /*  Variables for indexing the horizontal and vertical axes.              */
+    unsigned int x_index, y_index;
+
+    /*  Variable for indexing over the array being written to.                */
+    unsigned int index = 0U;
+
+    for (y_index = 0U; y_index < canvas->ny_pts; ++y_index)
+    {
+        /*  The indices are row-major, meaning index = y * width + x.         */
+        const unsigned int shift = y_index * canvas->nx_pts;
+
+        for (x_index = 0U; x_index < canvas->nx_pts; ++x_index)
+        {
+            const unsigned int index00 = shift + x_index;
+            const unsigned int index01 = index00 + 1U;
+            const unsigned int index10 = index00 + canvas->nx_pts;
+
+            /*  The top edge has no point above it.                           */
+            if (y_index != canvas->ny_pts - 1U)
+            {
+                store_line_segment(canvas, index, index00, index10);
+                index += 2U;
+            }
+
+            /*  The right edge has no point to its right.                     */
+            if (x_index != canvas->nx_pts - 1U)
+            {
+                store_line_segment(canvas, index, index00, index01);
+                index += 2U;
+            }
+        }
+        /*  End of horizontal for-loop.                                       */
+    }
+    /*  End of vertical for-loop.                                             */
+}
+/*  End of baseline_rectangular_wireframe.                                    */
+
+static void baseline_wireframe_kernel(Canvas * const canvas)
+{
+    baseline_rectangular_wireframe(canvas);
+}
+
+/*  The vertices and the square wireframe in two separate passes, the way     *
+ *  generate_canvas_wireframe computed them for a new grid before the fused   *
+ *  generator. The output buffer and normals are updated as in                *
+ *  generate_fused_wireframe.                                                 */
+static void two_pass_wireframe_kernel(Canvas * const canvas)
+{
+    generate_parametric_mesh(canvas, paraboloid);
+    baseline_rectangular_wireframe(canvas);
+    update_output_buffer(canvas);
+    compute_canvas_normals(canvas);
+}
+
+/*  The same buffers in a single pass. The cached topology is forgotten so    *
+ *  that the line segments are written every time, as in the two-pass kernel. */
+static void fused_wireframe_kernel(Canvas * const canvas)
+{
+    invalidate_index_topology(canvas);
+    generate_fused_wireframe(canvas, paraboloid);
+}
+
+/*  The two passes again, with the surface inlined from a lambda.             */
+static void template_two_pass_wireframe_kernel(Canvas * const canvas)
+{
+    template_parametric_mesh(canvas);
+    baseline_rectangular_wireframe(canvas);
+    update_output_buffer(canvas);
+    compute_canvas_normals(canvas);
+}
+
+/*  The single pass with the surface inlined, as the animations use it.       */
+static void template_fused_wireframe_kernel(Canvas * const canvas)
+{
+    template_fused_wireframe(canvas);
+}
+
+static void rotate_mesh_kernel(Canvas * const canvas)
+{
+    rotate_mesh(canvas, rotation);
+}
+
+static void transform_mesh_kernel(Canvas * const canvas)
+{
+    transform_mesh(canvas, &rotation_matrix);
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      benchmark_name                                                        *
+ *  Purpose:                                                                  *
+ *      Writes the name of a benchmark, like                                  *
+ *      generate_wireframe/Square/Interleaved/256x256.                        *
+ *  Arguments:                                                                *
+ *      benchmark (const Benchmark * const):                                  *
+ *          The benchmark being named.                                        *
+ *      name (char * const):                                                  *
+ *          The buffer the name is written to.                                *
+ *      size (size_t):                                                        *
+ *          The size of the buffer.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+benchmark_name(const Benchmark * const benchmark,
+               char * const name,
+               size_t size)
+{
+    const CanvasParameters * const parameters = &benchmark->parameters;
+    const char * const layout =
+        (parameters->layout == PlanarLayout ? "Planar" : "Interleaved");
+
+    snprintf(
+        name, size, "%s/%s/%s/%ux%u",
+        benchmark->kernel_name,
+        mesh_type_names[parameters->mesh_type],
+        layout,
+        parameters->nx_pts,
+        parameters->ny_pts
+    );
+}
+/*  End of benchmark_name.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_benchmark                                                         *
+ *  Purpose:                                                                  *
+ *      Times a benchmark and prints a line of the report.                    *
+ *  Arguments:                                                                *
+ *      benchmark (const Benchmark * const):                                  *
+ *          The benchmark being run.                                          *
+ *      options (const BenchmarkOptions * const):                             *
+ *          The options from the command line.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      As with Google Benchmark, the number of iterations is doubled until a *
+ *      batch runs for the minimum time, so each kernel is measured over many *
+ *      calls no matter how fast it is. Benchmarks whose name does not contain*
+ *      the filter are skipped.                                               *
+ ******************************************************************************/
+static void
+run_benchmark(const Benchmark * const benchmark,
+              const BenchmarkOptions * const options)
+{
+    char name[128];
+    Canvas *canvas;
+    unsigned long int iterations, index;
+    double elapsed, nanoseconds, points_per_second;
+
+    benchmark_name(benchmark, name, sizeof(name));
+
+    if (options->filter && !strstr(name, options->filter))
+        return;
+
+    canvas = create_canvas(&benchmark->parameters);
+
+    if (!canvas)
+    {
+        fprintf(stderr, "%s: could not allocate the canvas\n", name);
+        return;
+    }
+
+    /*  The wireframes and rotations need a mesh to work on.                  */
+    generate_parametric_mesh(canvas, paraboloid);
+
+    for (iterations = 1UL; ; iterations *= 2UL)
+    {
+        const double start = now();
+
+        for (index = 0UL; index < iterations; ++index)
+            benchmark->kernel(canvas);
+
+        elapsed = now() - start;
+
+        if (elapsed >= options->min_time)
+            break;
+    }
+
+    nanoseconds = 1.0E9 * elapsed / (double)iterations;
+    points_per_second = 1.0E9 * (double)canvas->number_of_points / nanoseconds;
+
+    if (options->csv)
+        printf(
+            "%s,%.1f,%lu,%.0f\n",
+            name, nanoseconds, iterations, points_per_second
+        );
+    else
+        printf(
+            "%-60s %12.1f ns %10lu %10.1fM\n",
+            name, nanoseconds, iterations, 1.0E-6 * points_per_second
+        );
+
+    destroy_canvas(canvas);
+}
+/*  End of run_benchmark.                                                     */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_benchmarks                                                        *
+ *  Purpose:                                                                  *
+ *      Runs every benchmark of one kernel for a list of sizes, layouts, and  *
+ *      mesh types.                                                           *
+ *  Arguments:                                                                *
+ *      kernel_name (const char * const):                                     *
+ *          The name of the kernel, the start of each benchmark name.         *
+ *      kernel (BenchmarkKernel):                                             *
+ *          The kernel being measured.                                        *
+ *      types (unsigned int):                                                 *
+ *          The number of mesh types to run, from the start of mesh_types, one*
+ *          for kernels that ignore the mesh type.                            *
+ *      layouts (unsigned int):                                               *
+ *          The number of layouts to run, one for interleaved only, or two for*
+ *          both.                                                             *
+ *      sizes (unsigned int):                                                 *
+ *          The number of grid sizes to run, from the start of grid_sizes.    *
+ *      options (const BenchmarkOptions * const):                             *
+ *          The options from the command line.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+run_benchmarks(const char * const kernel_name,
+               BenchmarkKernel kernel,
+               unsigned int types,
+               unsigned int layouts,
+               unsigned int sizes,
+               const BenchmarkOptions * const options)
+{
+    unsigned int type, layout, size;
+    Benchmark benchmark;
+
+    benchmark.kernel_name = kernel_name;
+    benchmark.kernel = kernel;
+    benchmark.parameters.width = 2.0F;
+    benchmark.parameters.height = 2.0F;
+    benchmark.parameters.x_start = -1.0F;
+    benchmark.parameters.y_start = -1.0F;
+    benchmark.parameters.rotation_mode = IncrementalRotation;
+
+    for (type = 0U; type < types; ++type)
+    {
+        benchmark.parameters.mesh_type = mesh_types[type];
+
+        for (layout = 0U; layout < layouts; ++layout)
+        {
+            benchmark.parameters.layout =
+                (layout == 0U ? InterleavedLayout : PlanarLayout);
+
+            for (size = 0U; size < sizes; ++size)
+            {
+                benchmark.parameters.nx_pts = grid_sizes[size];
+                benchmark.parameters.ny_pts = grid_sizes[size];
+                run_benchmark(&benchmark, options);
+            }
+        }
+    }
+}
+/*  End of run_benchmarks.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      main                                                                  *
+ *  Purpose:                                                                  *
+ *      Runs the microbenchmarks.                                             *
+ *  Arguments:                                                                *
+ *      argc (int):                                                           *
+ *          The number of command line arguments.                             *
+ *      argv (char **):                                                       *
+ *          The arguments. --filter=text only runs the benchmarks whose name  *
+ *          contains text, --min-time=seconds sets how long each is run for,  *
+ *          0.1 seconds by default, and --csv prints comma separated values   *
+ *          for comparing runs.                                               *
+ *  Output:                                                                   *
+ *      status (int):                                                         *
+ *          Zero on success, one for unknown arguments.                       *
+ *  Notes:                                                                    *
+ *      Build with make bench in common/csrc, which also runs it. The binary  *
+ *      is build/native/microbenchmarks, for use with perf or VTune.          *
+ ******************************************************************************/
+int main(int argc, char **argv)
+{
+    BenchmarkOptions options = {NULL, 0.1, 0};
+    const unsigned int all_sizes = ARRAY_LENGTH(grid_sizes);
+    const unsigned int all_types = ARRAY_LENGTH(mesh_types);
+    int index;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if (strncmp(argv[index], "--filter=", 9) == 0)
+            options.filter = argv[index] + 9;
+
+        else if (strncmp(argv[index], "--min-time=", 11) == 0)
+            options.min_time = strtod(argv[index] + 11, NULL);
+
+        else if (strcmp(argv[index], "--csv") == 0)
+            options.csv = 1;
+
+        else
+        {
+            fprintf(stderr, "unknown argument: %s\n", argv[index]);
+            return 1;
+        }
+    }
+
+    if (options.csv)
+        puts("name,ns_per_iteration,iterations,points_per_second");
+    else
+        printf(
+            "%-60s %15s %10s %11s\n",
+            "Benchmark", "Time", "Iterations", "Points/s"
+        );
+
+    /*  The mesh depends on the layout but not on the mesh type, the indices  *
+     *  depend on the mesh type but not on the layout. compute_index_size     *
+     *  does not depend on the size of the grid either.                       */
+    run_benchmarks(
+        "generate_parametric_mesh", parametric_mesh_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    /*  Trig calls per point against trig calls per row and column.           */
+    run_benchmarks(
+        "generate_surface_mesh", surface_mesh_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "generate_separable_surface_mesh", separable_surface_mesh_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "generate_tube_mesh", tube_mesh_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "generate_rectangular_wireframe", rectangular_wireframe_kernel,
+        1U, 1U, all_sizes, &options
+    );
+
+    /*  The per-vertex edge checks that store_rectangular_row replaced.       */
+    run_benchmarks(
+        "baseline_rectangular_wireframe", baseline_wireframe_kernel,
+        1U, 1U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "generate_wireframe", wireframe_kernel,
+        all_types, 1U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "compute_index_size", index_size_kernel,
+        all_types, 1U, 1U, &options
+    );
+
+    /*  One pass against two, for the square wireframe. The C versions call   *
+     *  the surface through a pointer, the template versions inline it.       */
+    run_benchmarks(
+        "two_pass_wireframe", two_pass_wireframe_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "fused_wireframe", fused_wireframe_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "template_two_pass_wireframe", template_two_pass_wireframe_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "template_fused_wireframe", template_fused_wireframe_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    run_benchmarks(
+        "rotate_mesh", rotate_mesh_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    /*  The general transform against the rotation it generalizes.            */
+    run_benchmarks(
+        "transform_mesh", transform_mesh_kernel,
+        1U, 2U, all_sizes, &options
+    );
+
+    return 0;
+}
+/*  End of main.                                                              */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef ARRAY_LENGTH
@@ -0,0 +1,54 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Kernels using the templates in threetools.hpp, with the surface as a  *
+ *      lambda, for comparison with the function pointer API.                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The templates being measured found here.                                  */
+#include <threetools/threetools.hpp>
+
+/*  Function prototypes for the kernels found here.                           */
+#include "template_kernels.h"
+
+/*  The same elliptic paraboloid as in microbenchmarks.c, written as a lambda *
+ *  so that it is inlined into the loops, as in the animations.               */
+static const auto paraboloid = [](float x, float y) -> float
+{
+    return x*x + 2.0F * y*y - 2.0F;
+};
+/*  End of paraboloid.                                                        */
+
+/*  One pass, as make_rectangular_wireframe computes a new grid.              */
+void template_fused_wireframe(Canvas * const canvas)
+{
+    invalidate_index_topology(canvas);
+    threetools::generate_fused_wireframe(canvas, paraboloid);
+}
+/*  End of template_fused_wireframe.                                          */
+
+/*  Only the vertices, the line segments are written by the caller.           */
+void template_parametric_mesh(Canvas * const canvas)
+{
+    threetools::generate_parametric_mesh(canvas, paraboloid);
+}
+/*  End of template_parametric_mesh.                                          */
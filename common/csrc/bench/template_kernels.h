@@ -0,0 +1,76 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Kernels using the templates in threetools.hpp, with the surface as a  *
+ *      lambda, for comparison with the function pointer API.                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_BENCH_TEMPLATE_KERNELS_H
+#define THREETOOLS_BENCH_TEMPLATE_KERNELS_H
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  The kernels are compiled as C++ and called from the C microbenchmarks.    */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      template_fused_wireframe                                              *
+ *  Purpose:                                                                  *
+ *      Computes the vertices and the square wireframe of the elliptic        *
+ *      paraboloid in one pass, with threetools::generate_fused_wireframe.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being benchmarked.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The cached topology is forgotten first, so the line segments are      *
+ *      written on every call.                                                *
+ ******************************************************************************/
+extern void template_fused_wireframe(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      template_parametric_mesh                                              *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of the elliptic paraboloid with                 *
+ *      threetools::generate_parametric_mesh.                                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being benchmarked.                                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void template_parametric_mesh(Canvas * const canvas);
+
+/*  End of extern "C" statement allowing C++ compatibility.                   */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,37 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the allocate_canvas function.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  Re-initializes a canvas from createCanvas, growing its buffers if needed. */
+static void
+allocate_canvas_handle(const uintptr_t ptr, CanvasParameters parameters)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    allocate_canvas(canvas, &parameters);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_allocate_canvas_function)
+{
+    emscripten::function("allocateCanvas", &allocate_canvas_handle);
+}
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the back_buffer_address function.  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+static uintptr_t get_back_buffer_address(const uintptr_t ptr)
+{
+    const Canvas * const canvas = reinterpret_cast<const Canvas * const>(ptr);
+    return reinterpret_cast<uintptr_t>(back_buffer_address(canvas));
+}
+
+EMSCRIPTEN_BINDINGS(threetools_back_buffer_address_function)
+{
+    emscripten::function("backBufferAddress", &get_back_buffer_address);
+}
@@ -0,0 +1,47 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the CanvasBand struct.             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  bool is easier to work with in JavaScript than an unsigned int flag.      */
+static bool done_getter(const CanvasBand& band)
+{
+    return band.done != 0U;
+}
+
+static void done_setter(CanvasBand& band, bool done)
+{
+    band.done = (done ? 1U : 0U);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_canvas_band_struct)
+{
+    emscripten::value_object<CanvasBand>("CanvasBand")
+        .field("firstRow", &CanvasBand::first_row)
+        .field("endRow", &CanvasBand::end_row)
+        .field("outputStart", &CanvasBand::output_start)
+        .field("outputCount", &CanvasBand::output_count)
+        .field("indexStart", &CanvasBand::index_start)
+        .field("indexCount", &CanvasBand::index_count)
+        .field("done", &done_getter, &done_setter);
+}
@@ -34,6 +34,61 @@ static void mesh_setter(Canvas& canvas, uintptr_t ptr)
     canvas.mesh = reinterpret_cast<float *>(ptr);
 }
 
+/*  The output buffer is another raw pointer to the vertices.                 */
+static uintptr_t output_getter(const Canvas& canvas)
+{
+    return reinterpret_cast<uintptr_t>(canvas.output);
+}
+
+static void output_setter(Canvas& canvas, uintptr_t ptr)
+{
+    canvas.output = reinterpret_cast<float *>(ptr);
+}
+
+/*  The back buffer is the output buffer for the other frame.                 */
+static uintptr_t back_output_getter(const Canvas& canvas)
+{
+    return reinterpret_cast<uintptr_t>(canvas.back_output);
+}
+
+static void back_output_setter(Canvas& canvas, uintptr_t ptr)
+{
+    canvas.back_output = reinterpret_cast<float *>(ptr);
+}
+
+/*  The normals are interleaved, like the output buffer.                      */
+static uintptr_t normals_getter(const Canvas& canvas)
+{
+    return reinterpret_cast<uintptr_t>(canvas.normals);
+}
+
+static void normals_setter(Canvas& canvas, uintptr_t ptr)
+{
+    canvas.normals = reinterpret_cast<float *>(ptr);
+}
+
+/*  The colors are packed RGB bytes, one color per point.                     */
+static uintptr_t colors_getter(const Canvas& canvas)
+{
+    return reinterpret_cast<uintptr_t>(canvas.colors);
+}
+
+static void colors_setter(Canvas& canvas, uintptr_t ptr)
+{
+    canvas.colors = reinterpret_cast<unsigned char *>(ptr);
+}
+
+/*  The color map is not owned by the canvas, only the address is stored.     */
+static uintptr_t color_map_getter(const Canvas& canvas)
+{
+    return reinterpret_cast<uintptr_t>(canvas.color_map);
+}
+
+static void color_map_setter(Canvas& canvas, uintptr_t ptr)
+{
+    canvas.color_map = reinterpret_cast<const ColorMap *>(ptr);
+}
+
 /*  The index buffer is also a raw pointer, provided a getter and a setter.   */
 static uintptr_t index_getter(const Canvas& canvas)
 {
@@ -42,22 +97,37 @@ static uintptr_t index_getter(const Canvas& canvas)
 
 static void index_setter(Canvas& canvas, uintptr_t ptr)
 {
-    canvas.indices = reinterpret_cast<unsigned int *>(ptr);
+    canvas.indices = reinterpret_cast<void *>(ptr);
 }
 
 EMSCRIPTEN_BINDINGS(threetools_canvas_struct)
 {
     emscripten::value_object<Canvas>("Canvas")
         .field("mesh", &mesh_getter, &mesh_setter)
+        .field("output", &output_getter, &output_setter)
+        .field("back_output", &back_output_getter, &back_output_setter)
+        .field("normals", &normals_getter, &normals_setter)
+        .field("colors", &colors_getter, &colors_setter)
+        .field("color_map", &color_map_getter, &color_map_setter)
         .field("indices", &index_getter, &index_setter)
         .field("number_of_points", &Canvas::number_of_points)
         .field("mesh_size", &Canvas::mesh_size)
         .field("index_size", &Canvas::index_size)
+        .field("mesh_capacity", &Canvas::mesh_capacity)
+        .field("output_capacity", &Canvas::output_capacity)
+        .field("index_capacity", &Canvas::index_capacity)
+        .field("back_output_capacity", &Canvas::back_output_capacity)
+        .field("normals_capacity", &Canvas::normals_capacity)
+        .field("colors_capacity", &Canvas::colors_capacity)
         .field("nx_pts", &Canvas::nx_pts)
         .field("ny_pts", &Canvas::ny_pts)
         .field("width", &Canvas::width)
         .field("height", &Canvas::height)
         .field("horizontal_start", &Canvas::horizontal_start)
         .field("vertical_start", &Canvas::vertical_start)
-        .field("mesh_type", &Canvas::mesh_type);
+        .field("mesh_type", &Canvas::mesh_type)
+        .field("index_type", &Canvas::index_type)
+        .field("layout", &Canvas::layout)
+        .field("rotation_mode", &Canvas::rotation_mode)
+        .field("angle", &Canvas::angle);
 }
@@ -32,5 +32,7 @@ EMSCRIPTEN_BINDINGS(threetools_canvas_parameters_struct)
         .field("height", &CanvasParameters::height)
         .field("xStart", &CanvasParameters::x_start)
         .field("yStart", &CanvasParameters::y_start)
-        .field("meshType", &CanvasParameters::mesh_type);
+        .field("meshType", &CanvasParameters::mesh_type)
+        .field("meshLayout", &CanvasParameters::layout)
+        .field("rotationMode", &CanvasParameters::rotation_mode);
 }
@@ -0,0 +1,39 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the canvas_pyramid_level function. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  The level is returned as an address, zero if there is no such level.      */
+static uintptr_t
+canvas_pyramid_level_handle(const uintptr_t ptr, unsigned int level)
+{
+    CanvasPyramid * const pyramid =
+        reinterpret_cast<CanvasPyramid * const>(ptr);
+
+    return reinterpret_cast<uintptr_t>(canvas_pyramid_level(pyramid, level));
+}
+
+EMSCRIPTEN_BINDINGS(threetools_canvas_pyramid_level_function)
+{
+    emscripten::function("canvasPyramidLevel", &canvas_pyramid_level_handle);
+}
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the CanvasUpdate struct.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  bool is easier to work with in JavaScript than an unsigned int flag.      */
+static bool views_changed_getter(const CanvasUpdate& update)
+{
+    return update.views_changed != 0U;
+}
+
+static void views_changed_setter(CanvasUpdate& update, bool changed)
+{
+    update.views_changed = (changed ? 1U : 0U);
+}
+
+static bool normals_changed_getter(const CanvasUpdate& update)
+{
+    return update.normals_changed != 0U;
+}
+
+static void normals_changed_setter(CanvasUpdate& update, bool changed)
+{
+    update.normals_changed = (changed ? 1U : 0U);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_canvas_update_struct)
+{
+    emscripten::value_object<CanvasUpdate>("CanvasUpdate")
+        .field("firstRow", &CanvasUpdate::first_row)
+        .field("outputStart", &CanvasUpdate::output_start)
+        .field("outputCount", &CanvasUpdate::output_count)
+        .field("indexStart", &CanvasUpdate::index_start)
+        .field("indexCount", &CanvasUpdate::index_count)
+        .field("viewsChanged", &views_changed_getter, &views_changed_setter)
+        .field(
+            "normalsChanged", &normals_changed_getter, &normals_changed_setter
+        );
+}
@@ -0,0 +1,43 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the compute_index_size function.   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  Geometries are sized before their canvas exists, and for the WebGPU path  *
+ *  there is no canvas at all. Only the grid and the mesh type are read, so   *
+ *  the size is computed for a canvas with no buffers.                        */
+static unsigned int compute_index_size_handle(CanvasParameters parameters)
+{
+    Canvas canvas = {};
+    canvas.nx_pts = parameters.nx_pts;
+    canvas.ny_pts = parameters.ny_pts;
+    canvas.mesh_type = parameters.mesh_type;
+
+    compute_index_size(&canvas);
+    return canvas.index_size;
+}
+
+EMSCRIPTEN_BINDINGS(threetools_compute_index_size_function)
+{
+    emscripten::function("computeIndexSize", &compute_index_size_handle);
+}
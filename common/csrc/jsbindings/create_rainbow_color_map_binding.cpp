@@ -0,0 +1,40 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the create_rainbow_color_map       *
+ *      function.                                                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  The map is returned as an address, like the canvases from create_canvas.  */
+static uintptr_t
+create_rainbow_color_map_handle(float min_value, float max_value)
+{
+    ColorMap * const map = create_rainbow_color_map(min_value, max_value);
+    return reinterpret_cast<uintptr_t>(map);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_create_rainbow_color_map_function)
+{
+    emscripten::function(
+        "createRainbowColorMap", &create_rainbow_color_map_handle
+    );
+}
@@ -0,0 +1,40 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the destroy_canvas_pyramid         *
+ *      function.                                                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+static void destroy_canvas_pyramid_handle(const uintptr_t ptr)
+{
+    CanvasPyramid * const pyramid =
+        reinterpret_cast<CanvasPyramid * const>(ptr);
+
+    destroy_canvas_pyramid(pyramid);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_destroy_canvas_pyramid_function)
+{
+    emscripten::function(
+        "destroyCanvasPyramid", &destroy_canvas_pyramid_handle
+    );
+}
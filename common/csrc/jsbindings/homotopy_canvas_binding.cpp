@@ -0,0 +1,39 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the homotopy_canvas function.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+static void
+homotopy_canvas_addresses(const uintptr_t ptr,
+                          const uintptr_t target_ptr,
+                          const float t)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    const Canvas * const target = reinterpret_cast<const Canvas *>(target_ptr);
+    homotopy_canvas(canvas, target, t);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_homotopy_canvas_function)
+{
+    emscripten::function("homotopyCanvas", &homotopy_canvas_addresses);
+}
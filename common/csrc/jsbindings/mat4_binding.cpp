@@ -0,0 +1,60 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the Mat4 struct.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  The entries are an array, bind each of them with a getter and setter. A   *
+ *  Mat4 is then passed as a plain array of 16 numbers, like the elements of  *
+ *  a three.js Matrix4.                                                       */
+template <unsigned int N>
+static float entry_getter(const Mat4& matrix)
+{
+    return matrix.entries[N];
+}
+
+template <unsigned int N>
+static void entry_setter(Mat4& matrix, float value)
+{
+    matrix.entries[N] = value;
+}
+
+EMSCRIPTEN_BINDINGS(threetools_mat4_struct)
+{
+    emscripten::value_array<Mat4>("Mat4")
+        .element(&entry_getter<0>, &entry_setter<0>)
+        .element(&entry_getter<1>, &entry_setter<1>)
+        .element(&entry_getter<2>, &entry_setter<2>)
+        .element(&entry_getter<3>, &entry_setter<3>)
+        .element(&entry_getter<4>, &entry_setter<4>)
+        .element(&entry_getter<5>, &entry_setter<5>)
+        .element(&entry_getter<6>, &entry_setter<6>)
+        .element(&entry_getter<7>, &entry_setter<7>)
+        .element(&entry_getter<8>, &entry_setter<8>)
+        .element(&entry_getter<9>, &entry_setter<9>)
+        .element(&entry_getter<10>, &entry_setter<10>)
+        .element(&entry_getter<11>, &entry_setter<11>)
+        .element(&entry_getter<12>, &entry_setter<12>)
+        .element(&entry_getter<13>, &entry_setter<13>)
+        .element(&entry_getter<14>, &entry_setter<14>)
+        .element(&entry_getter<15>, &entry_setter<15>);
+}
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the match_canvas_rotation function.*
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  bool is easier to work with in JavaScript than an unsigned int flag.      */
+static bool
+match_canvas_rotation_handle(const uintptr_t ptr, const uintptr_t reference_ptr)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+
+    const Canvas * const reference =
+        reinterpret_cast<const Canvas * const>(reference_ptr);
+
+    return match_canvas_rotation(canvas, reference) != 0U;
+}
+
+EMSCRIPTEN_BINDINGS(threetools_match_canvas_rotation_function)
+{
+    emscripten::function("matchCanvasRotation", &match_canvas_rotation_handle);
+}
@@ -0,0 +1,43 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the ProfileKernel enum.            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+EMSCRIPTEN_BINDINGS(threetools_profile_kernel_enum)
+{
+    emscripten::enum_<ProfileKernel>("ProfileKernel")
+        .value("ParametricMeshKernel", ParametricMeshKernel)
+        .value("SurfaceMeshKernel", SurfaceMeshKernel)
+        .value("WireframeKernel", WireframeKernel)
+        .value("RotateMeshKernel", RotateMeshKernel)
+        .value("RotateToOutputKernel", RotateToOutputKernel)
+        .value("PackPlanarKernel", PackPlanarKernel)
+        .value("ZRotateKernel", ZRotateKernel)
+        .value("NormalsKernel", NormalsKernel)
+        .value("ColorsKernel", ColorsKernel)
+        .value("HomotopyKernel", HomotopyKernel)
+        .value("VectorFieldKernel", VectorFieldKernel)
+        .value("FusedWireframeKernel", FusedWireframeKernel)
+        .value("TransformKernel", TransformKernel)
+        .value("TubeMeshKernel", TubeMeshKernel);
+}
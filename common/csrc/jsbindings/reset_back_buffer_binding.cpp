@@ -0,0 +1,37 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the reset_back_buffer function.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  Buffers are only allocated in WebAssembly, JavaScript can not provide     *
+ *  one, so the canvas always owns its back buffer.                           */
+static void allocate_back_buffer(const uintptr_t ptr)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    reset_back_buffer(canvas, NULL);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_reset_back_buffer_function)
+{
+    emscripten::function("resetBackBuffer", &allocate_back_buffer);
+}
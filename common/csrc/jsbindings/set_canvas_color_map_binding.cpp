@@ -0,0 +1,38 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the set_canvas_color_map function. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+/*  Passing zero for the map stops coloring the canvas.                       */
+static void
+set_canvas_color_map_handle(const uintptr_t canvas_ptr, const uintptr_t map_ptr)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(canvas_ptr);
+    const ColorMap * const map = reinterpret_cast<const ColorMap *>(map_ptr);
+    set_canvas_color_map(canvas, map);
+}
+
+EMSCRIPTEN_BINDINGS(threetools_set_canvas_color_map_function)
+{
+    emscripten::function("setCanvasColorMap", &set_canvas_color_map_handle);
+}
@@ -0,0 +1,40 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the vector_field_instances_address *
+ *      function.                                                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+static uintptr_t get_vector_field_instances_address(const uintptr_t ptr)
+{
+    const VectorFieldGrid * const grid =
+        reinterpret_cast<const VectorFieldGrid * const>(ptr);
+
+    return reinterpret_cast<uintptr_t>(vector_field_instances_address(grid));
+}
+
+EMSCRIPTEN_BINDINGS(threetools_vector_field_instances_address_function)
+{
+    emscripten::function(
+        "vectorFieldInstancesAddress", &get_vector_field_instances_address
+    );
+}
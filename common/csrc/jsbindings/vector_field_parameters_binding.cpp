@@ -0,0 +1,38 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides an emscripten binding for the VectorFieldParameters struct.  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.h>
+#include <emscripten/bind.h>
+
+EMSCRIPTEN_BINDINGS(threetools_vector_field_parameters_struct)
+{
+    emscripten::value_object<VectorFieldParameters>("VectorFieldParameters")
+        .field("nxPts", &VectorFieldParameters::nx_pts)
+        .field("nyPts", &VectorFieldParameters::ny_pts)
+        .field("nzPts", &VectorFieldParameters::nz_pts)
+        .field("width", &VectorFieldParameters::width)
+        .field("height", &VectorFieldParameters::height)
+        .field("depth", &VectorFieldParameters::depth)
+        .field("xStart", &VectorFieldParameters::x_start)
+        .field("yStart", &VectorFieldParameters::y_start)
+        .field("zStart", &VectorFieldParameters::z_start);
+}
@@ -23,16 +23,192 @@
  *  Author:     Ryan Maguire                                                  *
  *  Date:       October 30, 2025                                              *
  ******************************************************************************/
-import initModule from "main";
+/*  Smallest valid WebAssembly module that uses a SIMD128 instruction. It     *
+ *  only validates if the browser supports the SIMD proposal.                 */
+const simdTestModule = new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10,
+    10, 1, 8, 0, 65, 0, 253, 15, 253, 98, 11
+]);
 
-/*  emscripten compiles everything into a module. Initialize it.              */
-const module = await initModule();
+/*  Checks if the SIMD build of the module can be used by this browser.       */
+const simdSupported = WebAssembly.validate(simdTestModule);
+
+/*  The threaded build shares its memory between the workers, which needs a   *
+ *  cross-origin isolated page. It is also built with SIMD128 enabled.        */
+const pthreadSupported = simdSupported && globalThis.crossOriginIsolated;
+
+/*  The profiling build times the kernels, see getKernelCounter. It is only   *
+ *  used when asked for, by adding ?profile to the URL of the page.           */
+const profileRequested =
+    new URLSearchParams(globalThis.location?.search ?? "").has("profile");
+
+/*  Function for loading the module, preferring the SIMD variant if possible. */
+async function loadModule() {
+
+    /*  Animations with a profiling build list it as "main-profile". It is    *
+     *  built with SIMD128, like the module it stands in for.                 */
+    if (profileRequested && simdSupported) {
+        try {
+            return (await import("main-profile")).default;
+        } catch {
+            /*  No profiling build for this animation, load the usual one.    */
+        }
+    }
+
+    /*  Animations with a threaded build list it as "main-pthread".           */
+    if (pthreadSupported) {
+        try {
+            return (await import("main-pthread")).default;
+        } catch {
+            /*  No threaded build for this animation, try the SIMD version.   */
+        }
+    }
+
+    /*  Animations that provide a SIMD build list it as "main-simd" in the    *
+     *  import map. Older browsers, and animations without a SIMD build, fall *
+     *  back to the scalar "main" module.                                     */
+    if (simdSupported) {
+        try {
+            return (await import("main-simd")).default;
+        } catch {
+            /*  No SIMD build for this animation, use the scalar version.     */
+        }
+    }
+
+    return (await import("main")).default;
+}
+/*  End of loadModule.                                                        */
+
+/*  Animations using the shared build, threetools_shared.js in place of their *
+ *  own main.js, list the side module with their surface as "main-surface".   *
+ *  The import map is only used to resolve the URL, nothing is imported.      */
+function sideModuleURL() {
+    try {
+        return import.meta.resolve("main-surface");
+    } catch {
+        /*  Not listed, the surface is compiled into the main module.         */
+        return undefined;
+    }
+}
+/*  End of sideModuleURL.                                                     */
+
+/*  The side module, if any, is fetched and linked before the module starts.  *
+ *  emscripten passes the name through locateFile, which would otherwise      *
+ *  prefix the URL with the directory of the main module.                     */
+const surfaceURL = sideModuleURL();
+const moduleOptions = surfaceURL === undefined ? {} : {
+    dynamicLibraries: [surfaceURL],
+    locateFile: (path, prefix) => URL.canParse(path) ? path : prefix + path
+};
+
+/*  emscripten compiles everything into a module. Initialize it. The .wasm is *
+ *  compiled while it downloads, with WebAssembly.instantiateStreaming, and   *
+ *  the shared build is the same file, and hence cached, for every animation. */
+const initModule = await loadModule();
+const module = await initModule(moduleOptions);
+
+/*  Side modules export their surface as threetools_surface. If it is not     *
+ *  found the shared build renders the plane z = 0.                           */
+if (surfaceURL !== undefined) {
+    module.setSurfaceSymbol("threetools_surface");
+}
 
 /*  Export the C functions so that may be called in JavaScript.               */
+export const allocateCanvas = module.allocateCanvas;
+export const allocateVectorField = module.allocateVectorField;
+export const backBufferAddress = module.backBufferAddress;
+export const canvasPyramidLevel = module.canvasPyramidLevel;
+export const checkMemoryGrowth = module.checkMemoryGrowth;
+export const colorBufferAddress = module.colorBufferAddress;
+export const colorCanvas = module.colorCanvas;
+export const composeTransforms = module.composeTransforms;
+export const computeCanvasNormals = module.computeCanvasNormals;
+export const computeIndexSize = module.computeIndexSize;
+export const createCanvas = module.createCanvas;
+export const createCanvasPyramid = module.createCanvasPyramid;
+export const createRainbowColorMap = module.createRainbowColorMap;
+export const createVectorField = module.createVectorField;
+export const destroyCanvas = module.destroyCanvas;
+export const destroyCanvasPyramid = module.destroyCanvasPyramid;
+export const destroyColorMap = module.destroyColorMap;
+export const destroyVectorField = module.destroyVectorField;
+export const generateCanvasBand = module.generateCanvasBand;
+export const generateWireframe = module.generateWireframe;
+export const getKernelCounter = module.getKernelCounter;
+export const homotopyCanvas = module.homotopyCanvas;
 export const indexBufferAddress = module.indexBufferAddress;
+export const indexBufferType = module.indexBufferType;
+export const IndexType = module.IndexType;
 export const mainCanvasAddress = module.mainCanvasAddress;
+export const matchCanvasRotation = module.matchCanvasRotation;
 export const meshBufferAddress = module.meshBufferAddress;
-export const memory = module.HEAP8;
+export const normalBufferAddress = module.normalBufferAddress;
+export const outputBufferAddress = module.outputBufferAddress;
+export const ProfileKernel = module.ProfileKernel;
+export const profilingEnabled = module.profilingEnabled;
+export const MeshLayout = module.MeshLayout;
+export const MeshType = module.MeshType;
+export const resetBackBuffer = module.resetBackBuffer;
+export const resetColorBuffer = module.resetColorBuffer;
+export const resetKernelCounters = module.resetKernelCounters;
+export const resetNormalBuffer = module.resetNormalBuffer;
+export const RotationMode = module.RotationMode;
+export const sampleVectorField = module.sampleVectorField;
+export const setupCanvasMesh = module.setupCanvasMesh;
 export const setupMesh = module.setupMesh;
+export const setupPyramidMesh = module.setupPyramidMesh;
+export const setCanvasColorMap = module.setCanvasColorMap;
 export const setRotationAngle = module.setRotationAngle;
+export const setThreadCount = module.setThreadCount;
+export const swapOutputBuffers = module.swapOutputBuffers;
+export const transformCanvas = module.transformCanvas;
+export const transformMesh = module.transformMesh;
+export const updateCanvasMesh = module.updateCanvasMesh;
+export const updatePyramidMesh = module.updatePyramidMesh;
+export const vectorFieldInstancesAddress = module.vectorFieldInstancesAddress;
 export const zRotateCanvas = module.zRotateCanvas;
+
+/*  Only the threaded build spawns workers, the others ignore the count.      *
+ *  Modules built before the count could be set do not export the function.  */
+if (module.setThreadCount) {
+    setThreadCount(navigator.hardwareConcurrency ?? 1);
+}
+
+/*  The C buffers are allocated on the heap and the memory may grow, which    *
+ *  replaces the underlying ArrayBuffer. emscripten updates HEAP8 when this   *
+ *  happens, so always look up the current buffer rather than keeping a       *
+ *  reference to it.                                                          */
+export const memory = {
+    get buffer() {
+        return module.HEAP8.buffer;
+    }
+};
+
+/*  Functions called after the memory grows, see addMemoryGrowthListener.     */
+const memoryGrowthListeners = new Set();
+
+/*  libthreetools calls this from check_memory_growth, after an allocation    *
+ *  that grew the memory. The views into the old buffer are all detached.     */
+module.onMemoryGrowth = () => {
+    for (const listener of memoryGrowthListeners) {
+        listener();
+    }
+};
+
+/*  Adds a function that is called, with no arguments, whenever the memory    *
+ *  grows. Adding the same function twice has no effect.                      */
+export function addMemoryGrowthListener(listener) {
+    memoryGrowthListeners.add(listener);
+}
+
+/*  Removes a function added with addMemoryGrowthListener.                    */
+export function removeMemoryGrowthListener(listener) {
+    memoryGrowthListeners.delete(listener);
+}
+
+/*  Sets the surface for the shared build to a JavaScript function of x and y *
+ *  returning z. This is an alternative to a side module for simple surfaces, *
+ *  each point calls back into JavaScript, so it is slower for large meshes.  */
+export function registerSurface(surface) {
+    module.setSurface(module.addFunction(surface, "fff"));
+}
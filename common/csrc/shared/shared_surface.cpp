@@ -0,0 +1,138 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Per-figure functions for the shared build of threetools. The surface  *
+ *      is registered at run time, from a side module or from JavaScript.     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+#include <threetools/threetools.hpp>
+#include <emscripten/bind.h>
+#include <dlfcn.h>
+#include <string>
+
+/*  The surface being rendered, registered with setSurface or                 *
+ *  setSurfaceSymbol. Until then the mesh is the flat plane z = 0.            */
+static float flat_surface(float x, float y)
+{
+    static_cast<void>(x);
+    static_cast<void>(y);
+    return 0.0F;
+}
+/*  End of flat_surface.                                                      */
+
+static SurfaceParametrization shared_surface = flat_surface;
+
+/*  The templates in threetools.hpp are used, as in the figures, but the call *
+ *  through the pointer can not be inlined. This is the price of one shared   *
+ *  module, the mesh is only computed when the parameters change.             */
+static const auto surface = [](float x, float y) -> float
+{
+    return shared_surface(x, y);
+};
+/*  End of surface.                                                           */
+
+/*  Sets the surface to a function in the table, for example a JavaScript     *
+ *  function added with addFunction(f, "fff").                                */
+static void set_surface(const uintptr_t ptr)
+{
+    shared_surface = reinterpret_cast<SurfaceParametrization>(ptr);
+}
+/*  End of set_surface.                                                       */
+
+/*  Sets the surface to a function exported by a side module, loaded with the *
+ *  dynamicLibraries option of the module. Returns false if it is not found.  */
+static bool set_surface_symbol(const std::string& name)
+{
+    void * const symbol = dlsym(RTLD_DEFAULT, name.c_str());
+
+    /*  embind copied the name onto the heap before this was called, which    *
+     *  may have grown the memory, see check_memory_growth.                   */
+    check_memory_growth();
+
+    if (!symbol)
+        return false;
+
+    shared_surface = reinterpret_cast<SurfaceParametrization>(symbol);
+    return true;
+}
+/*  End of set_surface_symbol.                                                */
+
+/*  The rest is the same as the main.cpp of a figure, see                     *
+ *  surfaces/ellipticParaboloidWireframe/csrc/main.cpp.                       */
+static bool setup_mesh(CanvasParameters parameters)
+{
+    return threetools::make_rectangular_wireframe(&parameters, surface) != 0U;
+}
+/*  End of setup_mesh.                                                        */
+
+static bool setup_canvas_mesh(const uintptr_t ptr)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    return threetools::generate_canvas_wireframe(canvas, surface) != 0U;
+}
+/*  End of setup_canvas_mesh.                                                 */
+
+static CanvasUpdate
+update_canvas_mesh(const uintptr_t ptr, CanvasParameters parameters)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    return threetools::update_canvas(canvas, &parameters, surface);
+}
+/*  End of update_canvas_mesh.                                                */
+
+static CanvasBand
+generate_canvas_mesh_band(const uintptr_t ptr,
+                          unsigned int first_row,
+                          unsigned int rows)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    return threetools::generate_canvas_band(canvas, first_row, rows, surface);
+}
+/*  End of generate_canvas_mesh_band.                                         */
+
+static bool setup_pyramid_mesh(const uintptr_t ptr)
+{
+    CanvasPyramid * const pyramid =
+        reinterpret_cast<CanvasPyramid * const>(ptr);
+
+    return threetools::generate_canvas_pyramid(pyramid, surface) != 0U;
+}
+/*  End of setup_pyramid_mesh.                                                */
+
+static bool
+update_pyramid_mesh(const uintptr_t ptr, CanvasParameters parameters)
+{
+    CanvasPyramid * const pyramid =
+        reinterpret_cast<CanvasPyramid * const>(ptr);
+
+    return threetools::update_canvas_pyramid(pyramid, &parameters, surface);
+}
+/*  End of update_pyramid_mesh.                                               */
+
+EMSCRIPTEN_BINDINGS(threetools_shared)
+{
+    emscripten::function("setSurface", &set_surface);
+    emscripten::function("setSurfaceSymbol", &set_surface_symbol);
+    emscripten::function("setupMesh", &setup_mesh);
+    emscripten::function("setupCanvasMesh", &setup_canvas_mesh);
+    emscripten::function("updateCanvasMesh", &update_canvas_mesh);
+    emscripten::function("generateCanvasBand", &generate_canvas_mesh_band);
+    emscripten::function("setupPyramidMesh", &setup_pyramid_mesh);
+    emscripten::function("updatePyramidMesh", &update_pyramid_mesh);
+}
@@ -0,0 +1,222 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Checks that update_canvas gives the same canvas as generating it from *
+ *      scratch, built natively with make test.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+
+/*  printf found here.                                                        */
+#include <stdio.h>
+
+/*  EXIT_SUCCESS and EXIT_FAILURE found here.                                 */
+#include <stdlib.h>
+
+/*  Function prototypes for the kernels being tested found here.              */
+#include <threetools/threetools.h>
+
+/*  Number of elements in a fixed array.                                      */
+#define ARRAY_LENGTH(array) (sizeof(array) / sizeof((array)[0]))
+
+/*  A single test, returning the number of failed checks.                     */
+typedef struct CanvasTest {
+    const char *name;
+    unsigned int (*run)(void);
+} CanvasTest;
+
+/*  The surface used by every test, the elliptic paraboloid.                  */
+static float paraboloid(float x, float y)
+{
+    return 0.01F * (x*x + y*y);
+}
+
+/*  A square grid with a row spacing of one, so that rows are kept exactly    *
+ *  when the number of rows and the height change together.                   */
+static CanvasParameters grid_parameters(unsigned int ny_pts)
+{
+    CanvasParameters parameters = {0};
+    parameters.nx_pts = 64U;
+    parameters.ny_pts = ny_pts;
+    parameters.width = 63.0F;
+    parameters.height = (float)(ny_pts - 1U);
+    parameters.x_start = -31.5F;
+    parameters.y_start = -31.5F;
+    parameters.mesh_type = SquareWireframe;
+    parameters.layout = InterleavedLayout;
+    parameters.rotation_mode = IncrementalRotation;
+    return parameters;
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      compare_to_fresh_canvas                                               *
+ *  Purpose:                                                                  *
+ *      Compares the output and normals of a canvas with a canvas generated   *
+ *      from scratch for the same parameters.                                 *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas being checked.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters the canvas was last updated with.                  *
+ *  Output:                                                                   *
+ *      failures (unsigned int):                                              *
+ *          The number of buffers that differ, zero or one for each.          *
+ ******************************************************************************/
+static unsigned int
+compare_to_fresh_canvas(const Canvas * const canvas,
+                        const CanvasParameters * const parameters)
+{
+    unsigned int index;
+    unsigned int failures = 0U;
+    int output_differs = 0;
+    int normals_differ = 0;
+
+    Canvas * const fresh = create_canvas(parameters);
+
+    if (!fresh)
+    {
+        printf("    create_canvas failed\n");
+        return 1U;
+    }
+
+    if (canvas->normals)
+        reset_normal_buffer(fresh, NULL);
+
+    generate_canvas_wireframe(fresh, paraboloid);
+
+    if (fresh->mesh_size != canvas->mesh_size)
+    {
+        printf("    mesh size %u, expected %u\n",
+               canvas->mesh_size, fresh->mesh_size);
+        destroy_canvas(fresh);
+        return 1U;
+    }
+
+    /*  Both canvases are computed by the same kernels, the values must agree *
+     *  exactly.                                                              */
+    for (index = 0U; index < fresh->mesh_size; ++index)
+    {
+        if (canvas->output[index] != fresh->output[index])
+            output_differs = 1;
+
+        if (canvas->normals && canvas->normals[index] != fresh->normals[index])
+            normals_differ = 1;
+    }
+
+    if (output_differs)
+    {
+        printf("    the output differs from a fresh canvas\n");
+        ++failures;
+    }
+
+    if (normals_differ)
+    {
+        printf("    the normals differ from a fresh canvas\n");
+        ++failures;
+    }
+
+    destroy_canvas(fresh);
+    return failures;
+}
+/*  End of compare_to_fresh_canvas.                                           */
+
+/*  A transformed mesh no longer matches the surface, so an update that keeps *
+ *  rows must not keep it. Shrinking and then growing the grid would keep the *
+ *  transformed rows and append untransformed ones.                           */
+static unsigned int transform_then_update(void)
+{
+    unsigned int failures;
+    CanvasParameters parameters = grid_parameters(64U);
+    Canvas * const canvas = create_canvas(&parameters);
+
+    /*  A translation by -1 along the x axis, column-major.                   */
+    Mat4 translation = {{
+        1.0F, 0.0F, 0.0F, 0.0F,
+        0.0F, 1.0F, 0.0F, 0.0F,
+        0.0F, 0.0F, 1.0F, 0.0F,
+        -1.0F, 0.0F, 0.0F, 1.0F
+    }};
+
+    if (!canvas)
+        return 1U;
+
+    generate_canvas_wireframe(canvas, paraboloid);
+    transform_canvas(canvas, &translation);
+
+    parameters = grid_parameters(32U);
+    update_canvas(canvas, &parameters, paraboloid);
+
+    parameters = grid_parameters(64U);
+    update_canvas(canvas, &parameters, paraboloid);
+
+    failures = compare_to_fresh_canvas(canvas, &parameters);
+    destroy_canvas(canvas);
+    return failures;
+}
+
+/*  The gluing of the mesh type changes the step size and the normals, so a  *
+ *  new mesh type keeps none of the rows, even on the same grid.              */
+static unsigned int change_mesh_type(void)
+{
+    unsigned int failures;
+    CanvasParameters parameters = grid_parameters(64U);
+    Canvas * const canvas = create_canvas(&parameters);
+
+    if (!canvas)
+        return 1U;
+
+    reset_normal_buffer(canvas, NULL);
+    generate_canvas_wireframe(canvas, paraboloid);
+
+    parameters.mesh_type = CylindricalSquareWireframe;
+    update_canvas(canvas, &parameters, paraboloid);
+
+    failures = compare_to_fresh_canvas(canvas, &parameters);
+    destroy_canvas(canvas);
+    return failures;
+}
+
+/*  The tests, run in order.                                                  */
+static const CanvasTest tests[] = {
+    {"transform_then_update", transform_then_update},
+    {"change_mesh_type", change_mesh_type}
+};
+
+int main(void)
+{
+    unsigned int index;
+    unsigned int failed = 0U;
+
+    for (index = 0U; index < ARRAY_LENGTH(tests); ++index)
+    {
+        const unsigned int failures = tests[index].run();
+        printf("%s %s\n", failures == 0U ? "PASS" : "FAIL", tests[index].name);
+
+        if (failures != 0U)
+            ++failed;
+    }
+
+    printf("%u of %u tests passed\n",
+           (unsigned int)ARRAY_LENGTH(tests) - failed,
+           (unsigned int)ARRAY_LENGTH(tests));
+
+    return failed == 0U ? EXIT_SUCCESS : EXIT_FAILURE;
+}
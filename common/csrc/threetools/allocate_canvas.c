@@ -0,0 +1,124 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Initializes a canvas, allocating buffers sized for its parameters.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and CanvasParameters typedefs provided here.                       */
+#include <threetools/types.h>
+
+/*  canvas_points_overflow provided here.                                     */
+#include <threetools/indices.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      allocate_canvas                                                       *
+ *  Purpose:                                                                  *
+ *      Initializes a canvas from parameters, allocating the buffers.         *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas that is being initialized.                             *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the canvas, passed from JavaScript or Godot.   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The buffers are sized from the parameters and allocated on the heap,  *
+ *      growing as needed when the canvas is initialized again with a larger  *
+ *      grid. If an allocation fails the canvas is emptied, all of its sizes  *
+ *      are set to zero so no kernel will touch the buffers. Grids with more  *
+ *      than MAX_CANVAS_POINTS points are rejected, their buffer sizes would  *
+ *      overflow, and the canvas is emptied with free_canvas. A               *
+ *      zero-initialized canvas, like a global or static one, has no buffers  *
+ *      and may be passed to this function directly.                          *
+ ******************************************************************************/
+void
+allocate_canvas(Canvas * const canvas,
+                const CanvasParameters * const parameters)
+{
+    /*  Most of the JavaScript / Godot parameters are the same, copy them.    */
+    canvas->nx_pts = parameters->nx_pts;
+    canvas->ny_pts = parameters->ny_pts;
+    canvas->width = parameters->width;
+    canvas->height = parameters->height;
+    canvas->horizontal_start = parameters->x_start;
+    canvas->vertical_start = parameters->y_start;
+    canvas->mesh_type = parameters->mesh_type;
+    canvas->layout = parameters->layout;
+    canvas->rotation_mode = parameters->rotation_mode;
+    canvas->angle = 0.0F;
+
+    /*  The mesh is generated again by the caller, from the surface.          */
+    canvas->mesh_transformed = 0U;
+
+    /*  The sizes computed below would wrap around for this grid. Treat it as *
+     *  a failed allocation, nothing is left for the kernels to touch.        */
+    if (canvas_points_overflow(canvas->nx_pts, canvas->ny_pts))
+    {
+        free_canvas(canvas);
+        return;
+    }
+
+    /*  The remaining variables in the canvas can be computed from these. A   *
+     *  NULL buffer tells these functions to use storage owned by the canvas. */
+    reset_mesh_buffer(canvas, NULL);
+    reset_index_buffer(canvas, NULL);
+
+    /*  Interleaved meshes that are rotated in place can be rendered          *
+     *  directly. Planar meshes are packed into the output buffer first, and  *
+     *  absolute rotations write the rotated mesh to it, keeping the mesh     *
+     *  pristine.                                                             */
+    if (canvas->layout == InterleavedLayout &&
+        canvas->rotation_mode == IncrementalRotation)
+        reset_output_buffer(canvas, canvas->mesh);
+    else
+        reset_output_buffer(canvas, NULL);
+
+    /*  Double buffered canvases need a back buffer of the same size.         */
+    if (canvas->back_output)
+        reset_back_buffer(canvas, NULL);
+
+    /*  Likewise for canvases with per-vertex normals or colors.              */
+    if (canvas->normals)
+        reset_normal_buffer(canvas, NULL);
+
+    if (canvas->colors)
+        reset_color_buffer(canvas, NULL);
+
+    /*  If any of the allocations failed, empty the canvas. The grid size is  *
+     *  zeroed as well since the generators loop over nx_pts and ny_pts. A    *
+     *  failed back buffer is NULL and the canvas is no longer double         *
+     *  buffered, swap_output_buffers will do nothing. Failed normal and      *
+     *  color buffers are NULL as well, and are skipped by their kernels.     */
+    if (!canvas->mesh || !canvas->indices || !canvas->output)
+    {
+        canvas->nx_pts = 0U;
+        canvas->ny_pts = 0U;
+        canvas->number_of_points = 0U;
+        canvas->mesh_size = 0U;
+        canvas->index_size = 0U;
+    }
+}
+/*  End of allocate_canvas.                                                   */
@@ -0,0 +1,80 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Initializes a level-of-detail pyramid of canvases.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  CanvasPyramid and CanvasParameters typedefs provided here.                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/*  pyramid_level_count and pyramid_level_parameters found here.              */
+#include <threetools/pyramid.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      allocate_canvas_pyramid                                               *
+ *  Purpose:                                                                  *
+ *      Initializes every level of a pyramid from the parameters of the full  *
+ *      grid, allocating the buffers.                                         *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid being initialized.                                    *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the full grid, level zero.                     *
+ *      number_of_levels (unsigned int):                                      *
+ *          The number of levels requested. This is clamped, see              *
+ *          pyramid_level_count.                                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each level is initialized with allocate_canvas, so the buffers grow as*
+ *      needed and are kept between calls. Levels no longer in use are freed. *
+ *      A zero-initialized pyramid has no buffers and may be passed here      *
+ *      directly.                                                             *
+ ******************************************************************************/
+void
+allocate_canvas_pyramid(CanvasPyramid * const pyramid,
+                        const CanvasParameters * const parameters,
+                        unsigned int number_of_levels)
+{
+    unsigned int level;
+    const unsigned int count =
+        pyramid_level_count(parameters, number_of_levels);
+
+    pyramid->number_of_levels = count;
+
+    for (level = 0U; level < count; ++level)
+    {
+        const CanvasParameters level_parameters =
+            pyramid_level_parameters(parameters, level);
+
+        allocate_canvas(&pyramid->levels[level], &level_parameters);
+    }
+
+    /*  Fewer levels than before, release the buffers of the coarsest ones.   */
+    for (; level < CANVAS_PYRAMID_MAX_LEVELS; ++level)
+        free_canvas(&pyramid->levels[level]);
+}
+/*  End of allocate_canvas_pyramid.                                           */
@@ -0,0 +1,105 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Initializes a vector field grid, allocating the instance buffer.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  UINT_MAX macro provided here.                                             */
+#include <limits.h>
+
+/*  VectorFieldGrid and VectorFieldParameters typedefs provided here.         */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      allocate_vector_field                                                 *
+ *  Purpose:                                                                  *
+ *      Initializes a vector field grid from parameters, allocating the       *
+ *      instance buffer.                                                      *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid that is being initialized.                               *
+ *      parameters (const VectorFieldParameters * const):                     *
+ *          The parameters for the grid, passed from JavaScript.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The instance buffer grows as needed, like the buffers of a canvas, and*
+ *      never shrinks. If the allocation fails the grid is emptied, all of its*
+ *      sizes are set to zero. Grids whose instance buffer size overflows an  *
+ *      unsigned int are rejected the same way. A zero-initialized grid has   *
+ *      no buffer and may be passed to this function directly.                *
+ ******************************************************************************/
+void
+allocate_vector_field(VectorFieldGrid * const grid,
+                      const VectorFieldParameters * const parameters)
+{
+    /*  The largest number of arrows whose floats can be counted.             */
+    const unsigned int max_instances = UINT_MAX / VECTOR_FIELD_INSTANCE_SIZE;
+
+    /*  The JavaScript parameters are the same as the grid, copy them.        */
+    grid->nx_pts = parameters->nx_pts;
+    grid->ny_pts = parameters->ny_pts;
+    grid->nz_pts = parameters->nz_pts;
+    grid->width = parameters->width;
+    grid->height = parameters->height;
+    grid->depth = parameters->depth;
+    grid->x_start = parameters->x_start;
+    grid->y_start = parameters->y_start;
+    grid->z_start = parameters->z_start;
+
+    /*  Check that the products below do not wrap around. The grid is emptied *
+     *  if they would, as if the allocation had failed.                       */
+    if ((grid->nx_pts != 0U && grid->ny_pts > max_instances / grid->nx_pts) ||
+        (grid->nx_pts * grid->ny_pts != 0U &&
+         grid->nz_pts > max_instances / (grid->nx_pts * grid->ny_pts)))
+    {
+        free_vector_field(grid);
+        return;
+    }
+
+    /*  One arrow per point in the grid, each with its own instance.          */
+    grid->number_of_instances = grid->nx_pts * grid->ny_pts * grid->nz_pts;
+    grid->instances_size = grid->number_of_instances*VECTOR_FIELD_INSTANCE_SIZE;
+
+    grid->instances = resize_buffer(
+        grid->instances,
+        &grid->instances_capacity,
+        grid->instances_size,
+        sizeof(*grid->instances)
+    );
+
+    /*  If the allocation failed, empty the grid. The grid size is zeroed as  *
+     *  well since sample_vector_field loops over nx_pts, ny_pts, and nz_pts. */
+    if (!grid->instances)
+    {
+        grid->nx_pts = 0U;
+        grid->ny_pts = 0U;
+        grid->nz_pts = 0U;
+        grid->number_of_instances = 0U;
+        grid->instances_size = 0U;
+    }
+}
+/*  End of allocate_vector_field.                                             */
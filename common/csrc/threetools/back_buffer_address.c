@@ -0,0 +1,53 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the back buffer.                                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      back_buffer_address                                                   *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the second output buffer, used for double        *
+ *      buffering.                                                            *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the back buffer that we want.               *
+ *  Output:                                                                   *
+ *      back_output (float *):                                                *
+ *          A pointer to the back buffer, NULL if the canvas is not double    *
+ *          buffered.                                                         *
+ *  Notes:                                                                    *
+ *      After swap_output_buffers this is the buffer that was rendered last,  *
+ *      and the next frame is written to output_buffer_address.               *
+ ******************************************************************************/
+float *back_buffer_address(const Canvas * const canvas)
+{
+    return canvas->back_output;
+}
+/*  End of back_buffer_address.                                               */
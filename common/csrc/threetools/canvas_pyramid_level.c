@@ -0,0 +1,60 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns a level of a level-of-detail pyramid of canvases.             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  NULL is provided here.                                                    */
+#include <stddef.h>
+
+/*  Canvas and CanvasPyramid typedefs found here.                             */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      canvas_pyramid_level                                                  *
+ *  Purpose:                                                                  *
+ *      Returns the canvas for one level of a pyramid.                        *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid holding the level.                                    *
+ *      level (unsigned int):                                                 *
+ *          The level, zero for the full grid.                                *
+ *  Output:                                                                   *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas for the level, or NULL if the pyramid has no such      *
+ *          level.                                                            *
+ *  Notes:                                                                    *
+ *      The canvases live inside of the pyramid. They are freed with it and   *
+ *      must not be passed to destroy_canvas.                                 *
+ ******************************************************************************/
+Canvas *canvas_pyramid_level(CanvasPyramid * const pyramid, unsigned int level)
+{
+    if (level >= pyramid->number_of_levels)
+        return NULL;
+
+    return &pyramid->levels[level];
+}
+/*  End of canvas_pyramid_level.                                              */
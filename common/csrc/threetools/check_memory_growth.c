@@ -0,0 +1,87 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tells JavaScript when the WebAssembly memory has grown.               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  EM_JS, for calling back into JavaScript, is provided by emscripten.       *
+ *  Native builds have no views to refresh, and nothing to notify.            */
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+
+/*  Calls Module.onMemoryGrowth, if it has been set. jstools sets this, and   *
+ *  passes the call on to its listeners, see addMemoryGrowthListener.         */
+EM_JS(void, notify_memory_growth, (void), {
+    if (Module["onMemoryGrowth"]) {
+        Module["onMemoryGrowth"]();
+    }
+});
+
+#endif
+/*  End of #ifdef __EMSCRIPTEN__.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      check_memory_growth                                                   *
+ *  Purpose:                                                                  *
+ *      Notifies JavaScript if the WebAssembly memory has grown since the last*
+ *      check.                                                                *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Growing the memory replaces its ArrayBuffer and detaches every view   *
+ *      into it, including the vertex and index views of the geometries.      *
+ *      resize_buffer calls this after every allocation, as do the create     *
+ *      functions after their calloc, so the views are re-created only when   *
+ *      the memory actually grows. The first check only records the size, no  *
+ *      views exist yet. Allocations made outside of libthreetools, like the  *
+ *      strings and objects embind allocates, are caught by the next check,   *
+ *      and by checkMemoryViews in jscommon, which compares the buffer itself.*
+ ******************************************************************************/
+void check_memory_growth(void)
+{
+#if defined(__wasm__)
+
+    /*  The size of memory 0, the heap, in 64 KiB pages, the last time it was *
+     *  checked. Zero until the first check.                                  */
+    static unsigned long int memory_pages = 0UL;
+
+    const unsigned long int previous = memory_pages;
+    memory_pages = (unsigned long int)__builtin_wasm_memory_size(0);
+
+    /*  The first check happens before any views have been created.           */
+#ifdef __EMSCRIPTEN__
+    if (previous != 0UL && previous != memory_pages)
+        notify_memory_growth();
+#else
+    (void)previous;
+#endif
+
+#endif
+/*  End of #if defined(__wasm__).                                             */
+}
+/*  End of check_memory_growth.                                               */
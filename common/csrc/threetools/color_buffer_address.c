@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns the address of the color buffer of a canvas.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      color_buffer_address                                                  *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the packed RGB colors of a canvas.               *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the color buffer that we want.              *
+ *  Output:                                                                   *
+ *      colors (unsigned char *):                                             *
+ *          A pointer to the color buffer, NULL if the canvas has no colors.  *
+ *  Notes:                                                                    *
+ *      This function is called at the JavaScript level to get the address for*
+ *      the color attribute of the geometry, which is a normalized Uint8Array.*
+ ******************************************************************************/
+unsigned char *color_buffer_address(const Canvas * const canvas)
+{
+    return canvas->colors;
+}
+/*  End of color_buffer_address.                                              */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Colors the points of a canvas by their height.                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and ColorMap typedefs found here.                                  */
+#include <threetools/types.h>
+
+/*  write_color provided here.                                                */
+#include <threetools/color_map.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      color_canvas                                                          *
+ *  Purpose:                                                                  *
+ *      Recomputes the colors of a canvas from the heights of its points.     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, with a color buffer and a color map.                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases without colors or without a color map are left alone.        *
+ *      Parametric meshes, z = f(x, y), are colored as they are generated and *
+ *      do not need this. It is for meshes computed some other way, and for   *
+ *      the blended meshes of homotopy_canvas. The heights are read from the  *
+ *      output buffer, rotations about the z axis do not change them.         *
+ ******************************************************************************/
+void color_canvas(Canvas * const canvas)
+{
+    /*  Variable for indexing over the points.                                */
+    unsigned int index;
+
+    /*  Canvases without colors return early and are not counted.             */
+    PROFILE_START;
+
+    /*  Nothing to do if the canvas has no colors.                            */
+    if (!canvas->colors || !canvas->color_map)
+        return;
+
+    /*  The output is interleaved, the height is the third float of a point.  */
+    for (index = 0U; index < canvas->number_of_points; ++index)
+        write_color(
+            canvas->color_map,
+            canvas->output[3U * index + 2U],
+            canvas->colors + 3U * index
+        );
+
+    PROFILE_STOP(ColorsKernel, canvas->number_of_points);
+}
+/*  End of color_canvas.                                                      */
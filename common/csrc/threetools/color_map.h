@@ -0,0 +1,74 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides the lookup for color maps, shared by the colored kernels.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_COLOR_MAP_H
+#define THREETOOLS_COLOR_MAP_H
+
+/*  ColorMap typedef and COLOR_MAP_SIZE provided here.                        */
+#include <threetools/types.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      write_color                                                           *
+ *  Purpose:                                                                  *
+ *      Looks up the color for a value in a color map, writing it as packed   *
+ *      RGB.                                                                  *
+ *  Arguments:                                                                *
+ *      map (const ColorMap * const):                                         *
+ *          The color map.                                                    *
+ *      value (float):                                                        *
+ *          The value being colored, usually the height of a point.           *
+ *      rgb (unsigned char * const):                                          *
+ *          The three bytes where the color is written.                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Values are rounded to the nearest entry of the table. Values below the*
+ *      range, and NaN, get the first entry, values above it get the last.    *
+ ******************************************************************************/
+static inline void
+write_color(const ColorMap * const map, float value, unsigned char * const rgb)
+{
+    /*  Position of the value in the table, before rounding.                  */
+    const float position = (value - map->min_value) * map->index_factor;
+
+    /*  Written so that NaN fails the first comparison and is clamped too.    */
+    unsigned int index = 0U;
+
+    if (position >= (float)(COLOR_MAP_SIZE - 1U))
+        index = COLOR_MAP_SIZE - 1U;
+
+    else if (position > 0.0F)
+        index = (unsigned int)(position + 0.5F);
+
+    rgb[0] = map->table[3U * index];
+    rgb[1] = map->table[3U * index + 1U];
+    rgb[2] = map->table[3U * index + 2U];
+}
+/*  End of write_color.                                                       */
+
+#endif
+/*  End of include guard.                                                     */
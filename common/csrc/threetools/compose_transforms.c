@@ -0,0 +1,73 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Composes two 4x4 transforms into one.                                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Mat4 typedef found here.                                                  */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      compose_transforms                                                    *
+ *  Purpose:                                                                  *
+ *      Composes two transforms into a single matrix.                         *
+ *  Arguments:                                                                *
+ *      first (const Mat4 * const):                                           *
+ *          The transform that is applied first.                              *
+ *      second (const Mat4 * const):                                          *
+ *          The transform that is applied second.                             *
+ *  Output:                                                                   *
+ *      composition (Mat4):                                                   *
+ *          The matrix product second * first, which applies first and then   *
+ *          second.                                                           *
+ *  Notes:                                                                    *
+ *      This is the same order as the three.js premultiply. Chaining the calls*
+ *      composes any number of transforms, and transform_mesh then applies all*
+ *      of them in one pass over the mesh.                                    *
+ ******************************************************************************/
+Mat4 compose_transforms(const Mat4 * const first, const Mat4 * const second)
+{
+    /*  Variables for indexing the rows and columns of the product.           */
+    unsigned int row, column;
+    Mat4 composition;
+
+    /*  The entries are column-major, entry (row, column) is at the index     *
+     *  4 * column + row.                                                     */
+    for (column = 0U; column < 4U; ++column)
+    {
+        for (row = 0U; row < 4U; ++row)
+        {
+            const float * const a = second->entries + row;
+            const float * const b = first->entries + 4U * column;
+
+            composition.entries[4U * column + row] =
+                a[0] * b[0] + a[4] * b[1] + a[8] * b[2] + a[12] * b[3];
+        }
+    }
+
+    return composition;
+}
+/*  End of compose_transforms.                                                */
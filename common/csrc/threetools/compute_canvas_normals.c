@@ -0,0 +1,170 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the unit normals of a canvas from its grid, using central    *
+ *      differences.                                                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  sqrtf found here.                                                         */
+#include <math.h>
+
+/*  Canvas, EdgeGluing, and GridPoint typedefs found here.                    */
+#include <threetools/types.h>
+
+/*  grid_index and the gluing helpers provided here.                          */
+#include <threetools/gluing.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      compute_normal_rows                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the normals in a band of rows of a canvas.                   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, with the output buffer already up to date.            *
+ *      data (const void * const):                                            *
+ *          Pointer to the horizontal and vertical gluings of the grid.       *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The tangents are the differences of the two neighbors along each axis,*
+ *      using the gluings to step across glued edges. On an unglued edge the  *
+ *      point itself stands in for the missing neighbor, giving a one-sided   *
+ *      difference. Only the output buffer is read, so bands may run in       *
+ *      parallel.                                                             *
+ ******************************************************************************/
+static void
+compute_normal_rows(Canvas * const canvas,
+                    const void * const data,
+                    unsigned int first_row,
+                    unsigned int end_row)
+{
+    /*  The gluings are the same for every point, they are computed once.     */
+    const EdgeGluing * const gluing = (const EdgeGluing *)data;
+    const float * const points = canvas->output;
+
+    /*  Variables for indexing the horizontal and vertical axes.              */
+    unsigned int x_index, y_index;
+
+    for (y_index = first_row; y_index < end_row; ++y_index)
+    {
+        for (x_index = 0U; x_index < canvas->nx_pts; ++x_index)
+        {
+            const GridPoint point = {x_index, y_index};
+            GridPoint left = point, right = point, down = point, up = point;
+
+            /*  The normal for this point, which is being computed.           */
+            float * const normal =
+                canvas->normals + 3U * grid_index(canvas, point);
+
+            /*  Pointers to the neighbors along the two axes.                 */
+            const float *l, *r, *d, *u;
+
+            /*  Unit normal, the cross product of the two tangents.           */
+            float nx, ny, nz, norm, rcpr_norm;
+
+            /*  Points on an unglued edge use themselves as the neighbor.     */
+            if (!glue_left(canvas, gluing[0], &left))
+                left = point;
+
+            if (!glue_right(canvas, gluing[0], &right))
+                right = point;
+
+            if (!glue_down(canvas, gluing[1], &down))
+                down = point;
+
+            if (!glue_up(canvas, gluing[1], &up))
+                up = point;
+
+            l = points + 3U * grid_index(canvas, left);
+            r = points + 3U * grid_index(canvas, right);
+            d = points + 3U * grid_index(canvas, down);
+            u = points + 3U * grid_index(canvas, up);
+
+            /*  The cross product of the horizontal tangent, r - l, with the  *
+             *  vertical one, u - d. For z = f(x, y) this points up.          */
+            nx = (r[1] - l[1]) * (u[2] - d[2]) - (r[2] - l[2]) * (u[1] - d[1]);
+            ny = (r[2] - l[2]) * (u[0] - d[0]) - (r[0] - l[0]) * (u[2] - d[2]);
+            nz = (r[0] - l[0]) * (u[1] - d[1]) - (r[1] - l[1]) * (u[0] - d[0]);
+
+            /*  Degenerate points, like the poles of a sphere, have tangents  *
+             *  that vanish or are parallel. Their normal is left as zero.    */
+            norm = sqrtf(nx*nx + ny*ny + nz*nz);
+            rcpr_norm = (norm > 0.0F ? 1.0F / norm : 0.0F);
+
+            normal[0] = nx * rcpr_norm;
+            normal[1] = ny * rcpr_norm;
+            normal[2] = nz * rcpr_norm;
+        }
+        /*  End of horizontal for-loop.                                       */
+    }
+    /*  End of vertical for-loop.                                             */
+}
+/*  End of compute_normal_rows.                                               */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      compute_canvas_normals                                                *
+ *  Purpose:                                                                  *
+ *      Computes the unit normals of the output buffer of a canvas.           *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, with a normal buffer from reset_normal_buffer.        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases without a normal buffer are left alone. The normals come from*
+ *      the structured grid directly, using central differences, rather than  *
+ *      from the triangles as computeVertexNormals does in three.js. Glued    *
+ *      edges are differenced across the seam, so a torus has no crease.      *
+ *      Non-orientable surfaces, like the Mobius strip and Klein bottle, have *
+ *      no consistent normal, it flips sign across the twisted seam.          *
+ ******************************************************************************/
+void compute_canvas_normals(Canvas * const canvas)
+{
+    /*  The gluings for the horizontal and vertical axes, in that order.      */
+    EdgeGluing gluing[2];
+
+    /*  Canvases without normals return early and are not counted.            */
+    PROFILE_START;
+
+    /*  Nothing to do if the canvas has no normals.                           */
+    if (!canvas->normals)
+        return;
+
+    gluing[0] = horizontal_gluing(canvas->mesh_type);
+    gluing[1] = vertical_gluing(canvas->mesh_type);
+
+    parallel_rows(canvas, compute_normal_rows, gluing, 0U, canvas->ny_pts);
+    PROFILE_STOP(NormalsKernel, canvas->number_of_points);
+}
+/*  End of compute_canvas_normals.                                            */
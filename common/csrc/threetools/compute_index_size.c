@@ -26,6 +26,9 @@
 /*  Canvas and MeshType typedefs found here.                                  */
 #include <threetools/types.h>
 
+/*  MAX_UINT16_INDEX_POINTS macro and canvas_points_overflow provided here.   */
+#include <threetools/indices.h>
+
 /*  Function prototype / forward declaration given here.                      */
 #include <threetools/threetools.h>
 
@@ -33,15 +36,27 @@
  *  Function:                                                                 *
  *      compute_index_size                                                    *
  *  Purpose:                                                                  *
- *      Computes the number of elements needed for the index buffer.          *
+ *      Computes the number of elements needed for the index buffer, and the  *
+ *      type of the elements.                                                 *
  *  Arguments:                                                                *
  *      canvas (Canvas * const):                                              *
  *          The input canvas, the size of its index buffer is computed.       *
  *  Output:                                                                   *
  *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Grids with more than MAX_CANVAS_POINTS points get an index size of    *
+ *      zero, the products below would wrap around.                           *
  ******************************************************************************/
 void compute_index_size(Canvas * const canvas)
 {
+    /*  Too many points for a canvas. No index buffer, and nothing to draw.   */
+    if (canvas_points_overflow(canvas->nx_pts, canvas->ny_pts))
+    {
+        canvas->index_type = Uint32Indices;
+        canvas->index_size = 0U;
+        return;
+    }
+
     /*  The total number of points in the mesh is the product of the width    *
      *  and height. Points along the boundary usually have a different number *
      *  of line segments associated to them then those in the interior. The   *
@@ -53,6 +68,13 @@ void compute_index_size(Canvas * const canvas)
      *  vertical one. Subtract one from the sum to account for this.          */
     const unsigned int sum = canvas->nx_pts + canvas->ny_pts - 1;
 
+    /*  Small meshes can be indexed with 16-bit integers, halving the memory  *
+     *  and the bandwidth needed for the index buffer.                        */
+    if (product <= MAX_UINT16_INDEX_POINTS)
+        canvas->index_type = Uint16Indices;
+    else
+        canvas->index_type = Uint32Indices;
+
     /*  The number of line segments is given by the type of mesh being used.  */
     switch (canvas->mesh_type)
     {
@@ -88,18 +110,31 @@ void compute_index_size(Canvas * const canvas)
          *  to the top edge, and the left edge to the right edge.             */
         case TorodialSquareWireframe:
         case KleinSquareWireframe:
-        case ProjectiveSquareWireframe:
             canvas->index_size = 4U * product;
             break;
 
+        /*  Similar to the torus, but both gluings are twisted. The top-left  *
+         *  corner is glued to the bottom-right one vertically and            *
+         *  horizontally, and the top-right corner to the bottom-left one.    *
+         *  These two segments are only counted once.                         */
+        case ProjectiveSquareWireframe:
+            canvas->index_size = 4U * (product - 1U);
+            break;
+
         /*  Similar to triangle wireframes, but the bottom edge is connected  *
          *  to the top edge, and the left edge to the right edge.             */
         case TorodialTriangleWireframe:
         case KleinTriangleWireframe:
-        case ProjectiveTriangleWireframe:
             canvas->index_size = 6U * product;
             break;
 
+        /*  As for the square projective plane, two segments are counted      *
+         *  once. The diagonal of the top-left corner goes up to the          *
+         *  bottom-right corner and right back to itself, it is skipped.      */
+        case ProjectiveTriangleWireframe:
+            canvas->index_size = 6U * (product - 1U);
+            break;
+
         /*  Illegal input, set the size to zero.                              */
         default:
             canvas->index_size = 0;
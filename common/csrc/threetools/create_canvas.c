@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a canvas on the heap, for animations with several surfaces.   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  calloc and free are provided here.                                        */
+#include <stdlib.h>
+
+/*  Canvas and CanvasParameters typedefs provided here.                       */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_canvas                                                         *
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new canvas.                               *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the canvas, passed from JavaScript or Godot.   *
+ *  Output:                                                                   *
+ *      canvas (Canvas *):                                                    *
+ *          A pointer to the new canvas, or NULL if the allocation failed.    *
+ *  Notes:                                                                    *
+ *      The canvas, and the buffers it owns, must be freed with               *
+ *      destroy_canvas.                                                       *
+ ******************************************************************************/
+Canvas *create_canvas(const CanvasParameters * const parameters)
+{
+    /*  calloc zeroes the canvas, so it starts with no buffers and no         *
+     *  capacity.                                                             */
+    Canvas * const canvas = calloc(1, sizeof(*canvas));
+
+    /*  Check if calloc failed. Abort if so.                                  */
+    if (!canvas)
+        return NULL;
+
+    /*  Allocate the buffers for the requested grid.                          */
+    allocate_canvas(canvas, parameters);
+
+    /*  allocate_canvas empties the canvas if any of its allocations failed,  *
+     *  or if the grid is too large. The grid size is zero only if this       *
+     *  happened for a non-empty grid.                                        */
+    if (canvas->nx_pts == 0U &&
+        parameters->nx_pts != 0U && parameters->ny_pts != 0U)
+    {
+        destroy_canvas(canvas);
+        return NULL;
+    }
+
+    /*  calloc may have grown the memory, see check_memory_growth.            */
+    check_memory_growth();
+
+    return canvas;
+}
+/*  End of create_canvas.                                                     */
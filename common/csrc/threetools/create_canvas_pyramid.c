@@ -0,0 +1,86 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new level-of-detail pyramid of canvases.  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  calloc and free are provided here.                                        */
+#include <stdlib.h>
+
+/*  CanvasPyramid and CanvasParameters typedefs provided here.                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_canvas_pyramid                                                 *
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new level-of-detail pyramid of canvases.  *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the full grid, passed from JavaScript or Godot.*
+ *      number_of_levels (unsigned int):                                      *
+ *          The number of levels requested, see pyramid_level_count.          *
+ *  Output:                                                                   *
+ *      pyramid (CanvasPyramid *):                                            *
+ *          A pointer to the new pyramid, or NULL if any allocation failed.   *
+ *  Notes:                                                                    *
+ *      The pyramid, and the buffers it owns, must be freed with              *
+ *      destroy_canvas_pyramid.                                               *
+ ******************************************************************************/
+CanvasPyramid *
+create_canvas_pyramid(const CanvasParameters * const parameters,
+                      unsigned int number_of_levels)
+{
+    unsigned int level;
+
+    /*  calloc zeroes the pyramid, so every level starts with no buffers.     */
+    CanvasPyramid * const pyramid = calloc(1, sizeof(*pyramid));
+
+    /*  Check if calloc failed. Abort if so.                                  */
+    if (!pyramid)
+        return NULL;
+
+    allocate_canvas_pyramid(pyramid, parameters, number_of_levels);
+
+    /*  A level whose allocation failed was emptied by allocate_canvas. Its   *
+     *  grid size is zero only if this happened for a non-empty grid.         */
+    for (level = 0U; level < pyramid->number_of_levels; ++level)
+    {
+        const Canvas * const canvas = &pyramid->levels[level];
+
+        if (canvas->nx_pts == 0U &&
+            parameters->nx_pts != 0U && parameters->ny_pts != 0U)
+        {
+            destroy_canvas_pyramid(pyramid);
+            return NULL;
+        }
+    }
+
+    /*  calloc may have grown the memory, see check_memory_growth.            */
+    check_memory_growth();
+
+    return pyramid;
+}
+/*  End of create_canvas_pyramid.                                             */
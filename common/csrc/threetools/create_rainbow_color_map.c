@@ -0,0 +1,67 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Allocates a new rainbow color map.                                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  malloc is provided here.                                                  */
+#include <stdlib.h>
+
+/*  ColorMap typedef found here.                                              */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_rainbow_color_map                                              *
+ *  Purpose:                                                                  *
+ *      Allocates a rainbow color map, blue at the minimum value and red at   *
+ *      the maximum.                                                          *
+ *  Arguments:                                                                *
+ *      min_value (float):                                                    *
+ *          The value that is colored blue.                                   *
+ *      max_value (float):                                                    *
+ *          The value that is colored red.                                    *
+ *  Output:                                                                   *
+ *      map (ColorMap *):                                                     *
+ *          A pointer to the new color map, or NULL if the allocation failed. *
+ *  Notes:                                                                    *
+ *      The color map must be freed with destroy_color_map, after every canvas*
+ *      using it has been given a new map or destroyed.                       *
+ ******************************************************************************/
+ColorMap *create_rainbow_color_map(float min_value, float max_value)
+{
+    ColorMap * const map = malloc(sizeof(*map));
+
+    /*  Check if malloc failed. Abort if so.                                  */
+    if (!map)
+        return NULL;
+
+    /*  The allocation may have grown the memory, see check_memory_growth.    */
+    check_memory_growth();
+
+    make_rainbow_color_map(map, min_value, max_value);
+    return map;
+}
+/*  End of create_rainbow_color_map.                                          */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new vector field grid.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  calloc is provided here.                                                  */
+#include <stdlib.h>
+
+/*  VectorFieldGrid and VectorFieldParameters typedefs provided here.         */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_vector_field                                                   *
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new vector field grid.                    *
+ *  Arguments:                                                                *
+ *      parameters (const VectorFieldParameters * const):                     *
+ *          The parameters for the grid, passed from JavaScript.              *
+ *  Output:                                                                   *
+ *      grid (VectorFieldGrid *):                                             *
+ *          A pointer to the new grid, or NULL if the allocation failed.      *
+ *  Notes:                                                                    *
+ *      The grid, and its instance buffer, must be freed with                 *
+ *      destroy_vector_field.                                                 *
+ ******************************************************************************/
+VectorFieldGrid *
+create_vector_field(const VectorFieldParameters * const parameters)
+{
+    /*  calloc zeroes the grid, so it starts with no buffer and no capacity.  */
+    VectorFieldGrid * const grid = calloc(1, sizeof(*grid));
+
+    /*  Check if calloc failed. Abort if so.                                  */
+    if (!grid)
+        return NULL;
+
+    /*  Allocate the instance buffer for the requested grid.                  */
+    allocate_vector_field(grid, parameters);
+
+    /*  allocate_vector_field empties the grid if the allocation failed. The  *
+     *  buffer is NULL only if this happened for a non-empty grid.            */
+    if (!grid->instances && parameters->nx_pts != 0U &&
+        parameters->ny_pts != 0U && parameters->nz_pts != 0U)
+    {
+        destroy_vector_field(grid);
+        return NULL;
+    }
+
+    /*  calloc may have grown the memory, see check_memory_growth.            */
+    check_memory_growth();
+
+    return grid;
+}
+/*  End of create_vector_field.                                               */
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees a canvas created by create_canvas.                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free is provided here.                                                    */
+#include <stdlib.h>
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_canvas                                                        *
+ *  Purpose:                                                                  *
+ *      Frees a canvas and the buffers it owns.                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being destroyed. May be NULL, in which case nothing is *
+ *          done.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Only use this with canvases from create_canvas. The main canvas is a  *
+ *      global and must not be passed here.                                   *
+ ******************************************************************************/
+void destroy_canvas(Canvas * const canvas)
+{
+    /*  Nothing to do for a NULL pointer, mimicking the behavior of free.     */
+    if (!canvas)
+        return;
+
+    /*  Free the buffers first, then the canvas itself.                       */
+    free_canvas(canvas);
+    free(canvas);
+}
+/*  End of destroy_canvas.                                                    */
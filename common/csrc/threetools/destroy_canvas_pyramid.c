@@ -0,0 +1,59 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees a level-of-detail pyramid created by create_canvas_pyramid.     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free is provided here.                                                    */
+#include <stdlib.h>
+
+/*  CanvasPyramid typedef found here.                                         */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_canvas_pyramid                                                *
+ *  Purpose:                                                                  *
+ *      Frees a pyramid and the buffers it owns.                              *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid being destroyed. May be NULL, in which case nothing is*
+ *          done.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Only use this with pyramids from create_canvas_pyramid.               *
+ ******************************************************************************/
+void destroy_canvas_pyramid(CanvasPyramid * const pyramid)
+{
+    /*  Nothing to do for a NULL pointer, mimicking the behavior of free.     */
+    if (!pyramid)
+        return;
+
+    /*  Free the buffers of every level first, then the pyramid itself.       */
+    free_canvas_pyramid(pyramid);
+    free(pyramid);
+}
+/*  End of destroy_canvas_pyramid.                                            */
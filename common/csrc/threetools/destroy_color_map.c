@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees a color map.                                                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free is provided here.                                                    */
+#include <stdlib.h>
+
+/*  ColorMap typedef found here.                                              */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_color_map                                                     *
+ *  Purpose:                                                                  *
+ *      Frees a color map created by create_rainbow_color_map.                *
+ *  Arguments:                                                                *
+ *      map (ColorMap * const):                                               *
+ *          The color map being destroyed. May be NULL, in which case nothing *
+ *          is done.                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+void destroy_color_map(ColorMap * const map)
+{
+    free(map);
+}
+/*  End of destroy_color_map.                                                 */
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees a vector field grid and its instance buffer.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free is provided here.                                                    */
+#include <stdlib.h>
+
+/*  VectorFieldGrid typedef found here.                                       */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_vector_field                                                  *
+ *  Purpose:                                                                  *
+ *      Frees a vector field grid and the instance buffer it owns.            *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid being destroyed. May be NULL, in which case nothing is   *
+ *          done.                                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Only use this with grids from create_vector_field.                    *
+ ******************************************************************************/
+void destroy_vector_field(VectorFieldGrid * const grid)
+{
+    /*  Nothing to do for a NULL pointer, mimicking the behavior of free.     */
+    if (!grid)
+        return;
+
+    /*  Free the buffer first, then the grid itself.                          */
+    free_vector_field(grid);
+    free(grid);
+}
+/*  End of destroy_vector_field.                                              */
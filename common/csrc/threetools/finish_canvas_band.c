@@ -0,0 +1,66 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Brings a canvas up to date after the rows of a band were computed.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and CanvasBand typedefs found here.                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      finish_canvas_band                                                    *
+ *  Purpose:                                                                  *
+ *      Brings the output, normal, and index buffers of a canvas up to date   *
+ *      after the mesh rows of a band were computed.                          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being generated.                                       *
+ *      band (const CanvasBand * const):                                      *
+ *          The band from plan_canvas_band.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The index buffer only depends on the shape of the grid, it is         *
+ *      generated in full with the first band, and is cached as usual. Normals*
+ *      depend on the neighboring rows and are computed once the last band is *
+ *      done.                                                                 *
+ ******************************************************************************/
+void
+finish_canvas_band(Canvas * const canvas, const CanvasBand * const band)
+{
+    /*  The line segments are ready before any of them may be drawn.          */
+    if (band->first_row == 0U)
+        generate_cached_wireframe(canvas);
+
+    /*  Planar meshes and absolute rotations render from a separate buffer.   *
+     *  The rows outside of the band are recomputed to the same values.       */
+    if (band->end_row != band->first_row)
+        update_output_buffer(canvas);
+
+    if (band->done)
+        compute_canvas_normals(canvas);
+}
+/*  End of finish_canvas_band.                                                */
@@ -0,0 +1,74 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Completes an incremental update of a canvas.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and CanvasUpdate typedefs found here.                              */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      finish_canvas_update                                                  *
+ *  Purpose:                                                                  *
+ *      Brings the output and index buffers of a canvas up to date after the  *
+ *      mesh rows of an update were computed.                                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      update (CanvasUpdate * const):                                        *
+ *          The update from plan_canvas_update. The dirty range of the index  *
+ *          buffer and normals_changed are set here.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The index buffer is only regenerated if the topology of the grid      *
+ *      changed, it is skipped entirely otherwise.                            *
+ ******************************************************************************/
+void
+finish_canvas_update(Canvas * const canvas, CanvasUpdate * const update)
+{
+    /*  Planar meshes and absolute rotations render from a separate buffer,   *
+     *  which only needs to be recomputed if some rows changed.               */
+    if (update->first_row < canvas->ny_pts)
+    {
+        update_output_buffer(canvas);
+        update->normals_changed = 1U;
+    }
+
+    /*  The normals near the changed rows change too, as do the normals of    *
+     *  the new last row if rows were removed. Glued grids wrap around, so    *
+     *  all of them are recomputed.                                           */
+    if (update->normals_changed)
+        compute_canvas_normals(canvas);
+
+    /*  The line segments depend only on the topology of the grid.            */
+    if (generate_cached_wireframe(canvas))
+    {
+        update->index_start = 0U;
+        update->index_count = canvas->index_size;
+    }
+}
+/*  End of finish_canvas_update.                                              */
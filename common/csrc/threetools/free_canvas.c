@@ -0,0 +1,92 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Releases the buffers owned by a canvas.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free is provided here.                                                    */
+#include <stdlib.h>
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      free_canvas                                                           *
+ *  Purpose:                                                                  *
+ *      Frees the buffers allocated by allocate_canvas.                       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose buffers are being freed.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Buffers provided by the caller, which have zero capacity, are not     *
+ *      freed. The canvas is left empty and may be passed to allocate_canvas  *
+ *      again.                                                                *
+ ******************************************************************************/
+void free_canvas(Canvas * const canvas)
+{
+    /*  The output buffer may alias the mesh, in which case it is not owned.  */
+    if (canvas->output_capacity != 0U)
+        free(canvas->output);
+
+    if (canvas->back_output_capacity != 0U)
+        free(canvas->back_output);
+
+    if (canvas->normals_capacity != 0U)
+        free(canvas->normals);
+
+    if (canvas->colors_capacity != 0U)
+        free(canvas->colors);
+
+    if (canvas->mesh_capacity != 0U)
+        free(canvas->mesh);
+
+    if (canvas->index_capacity != 0U)
+        free(canvas->indices);
+
+    /*  Empty the canvas so that no kernel reads from the freed memory.       */
+    canvas->mesh = NULL;
+    canvas->output = NULL;
+    canvas->back_output = NULL;
+    canvas->normals = NULL;
+    canvas->colors = NULL;
+    canvas->color_map = NULL;
+    canvas->indices = NULL;
+    canvas->mesh_capacity = 0U;
+    canvas->output_capacity = 0U;
+    canvas->back_output_capacity = 0U;
+    canvas->normals_capacity = 0U;
+    canvas->colors_capacity = 0U;
+    canvas->index_capacity = 0U;
+    canvas->nx_pts = 0U;
+    canvas->ny_pts = 0U;
+    canvas->number_of_points = 0U;
+    canvas->mesh_size = 0U;
+    canvas->index_size = 0U;
+    invalidate_index_topology(canvas);
+}
+/*  End of free_canvas.                                                       */
@@ -0,0 +1,55 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the buffers of a level-of-detail pyramid of canvases.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  CanvasPyramid typedef found here.                                         */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      free_canvas_pyramid                                                   *
+ *  Purpose:                                                                  *
+ *      Frees the buffers allocated by allocate_canvas_pyramid.               *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid whose buffers are being freed.                        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The pyramid is left with no levels and may be passed to               *
+ *      allocate_canvas_pyramid again.                                        *
+ ******************************************************************************/
+void free_canvas_pyramid(CanvasPyramid * const pyramid)
+{
+    unsigned int level;
+
+    for (level = 0U; level < CANVAS_PYRAMID_MAX_LEVELS; ++level)
+        free_canvas(&pyramid->levels[level]);
+
+    pyramid->number_of_levels = 0U;
+}
+/*  End of free_canvas_pyramid.                                               */
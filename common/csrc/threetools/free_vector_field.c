@@ -0,0 +1,64 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Frees the instance buffer of a vector field grid.                     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free is provided here.                                                    */
+#include <stdlib.h>
+
+/*  VectorFieldGrid typedef found here.                                       */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      free_vector_field                                                     *
+ *  Purpose:                                                                  *
+ *      Frees the instance buffer allocated by allocate_vector_field.         *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid whose instance buffer is being freed.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The grid is left empty and may be passed to allocate_vector_field     *
+ *      again.                                                                *
+ ******************************************************************************/
+void free_vector_field(VectorFieldGrid * const grid)
+{
+    if (grid->instances_capacity != 0U)
+        free(grid->instances);
+
+    /*  Empty the grid so that sample_vector_field does not write to the      *
+     *  freed memory.                                                         */
+    grid->instances = NULL;
+    grid->instances_capacity = 0U;
+    grid->nx_pts = 0U;
+    grid->ny_pts = 0U;
+    grid->nz_pts = 0U;
+    grid->number_of_instances = 0U;
+    grid->instances_size = 0U;
+}
+/*  End of free_vector_field.                                                 */
@@ -0,0 +1,217 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a batched general                *
+ *      parametrization.                                                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and ParametricSurfaceBatch typedefs found here.                    */
+#include <threetools/types.h>
+
+/*  grid_step and the gluing helpers provided here.                           */
+#include <threetools/gluing.h>
+
+/*  SIMD helpers for interleaving points, only used with -msimd128.           */
+#include <threetools/simd.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/*  The number of points passed to the surface at once. Rows that are longer  *
+ *  than this are split into several batches. The scratch arrays below live   *
+ *  on the stack, this keeps them small.                                      */
+#define SURFACE_BATCH_SIZE (256U)
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      interleave_batch                                                      *
+ *  Purpose:                                                                  *
+ *      Interleaves a batch of points and writes them to an interleaved mesh. *
+ *  Arguments:                                                                *
+ *      mesh (float * const):                                                 *
+ *          Pointer to the x component of the first point being written.      *
+ *      x (const float * const):                                              *
+ *          The x components of the points.                                   *
+ *      y (const float * const):                                              *
+ *          The y components of the points.                                   *
+ *      z (const float * const):                                              *
+ *          The z components of the points.                                   *
+ *      length (unsigned int):                                                *
+ *          The number of points in the batch.                                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+interleave_batch(float * const mesh,
+                 const float * const x,
+                 const float * const y,
+                 const float * const z,
+                 unsigned int length)
+{
+    /*  Variable for indexing over the batch.                                 */
+    unsigned int n = 0U;
+
+#if defined(__wasm_simd128__)
+
+    /*  Four points at a time, splitting the xyz shuffles across vectors.     */
+    for (; n + 4U <= length; n += 4U)
+    {
+        const v128_t xs = wasm_v128_load(x + n);
+        const v128_t ys = wasm_v128_load(y + n);
+        const v128_t zs = wasm_v128_load(z + n);
+        simd_store_xyz4(mesh + 3U * n, xs, ys, zs);
+    }
+
+#endif
+
+    /*  Scalar loop for the remaining points, and for the non-SIMD build.     */
+    for (; n < length; ++n)
+    {
+        mesh[3U * n] = x[n];
+        mesh[3U * n + 1U] = y[n];
+        mesh[3U * n + 2U] = z[n];
+    }
+}
+/*  End of interleave_batch.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_batched_surface_rows                                         *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a band of rows of a mesh, a batch at a time. *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the ParametricSurfaceBatch defining the surface.       *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+generate_batched_surface_rows(Canvas * const canvas,
+                              const void * const data,
+                              unsigned int first_row,
+                              unsigned int end_row)
+{
+    /*  The surface is passed by address, function pointers can not be stored *
+     *  in a void pointer.                                                    */
+    const ParametricSurfaceBatch f =
+        *(const ParametricSurfaceBatch *)data;
+
+    /*  Step sizes in the horizontal and vertical axes.                       */
+    const EdgeGluing horizontal = horizontal_gluing(canvas->mesh_type);
+    const EdgeGluing vertical = vertical_gluing(canvas->mesh_type);
+    const float du = grid_step(canvas->width, canvas->nx_pts, horizontal);
+    const float dv = grid_step(canvas->height, canvas->ny_pts, vertical);
+
+    /*  Planar meshes store each component contiguously, get the planes.      */
+    const unsigned int size = canvas->number_of_points;
+    float * const x_plane = canvas->mesh;
+    float * const y_plane = canvas->mesh + size;
+    float * const z_plane = canvas->mesh + 2U * size;
+
+    /*  Scratch space for the parameters, and the components of the points    *
+     *  for interleaved meshes.                                               */
+    float u[SURFACE_BATCH_SIZE];
+    float x[SURFACE_BATCH_SIZE], y[SURFACE_BATCH_SIZE], z[SURFACE_BATCH_SIZE];
+
+    /*  Variables for indexing the vertical axis and the batches in a row.    */
+    unsigned int v_index, start;
+
+    for (v_index = first_row; v_index < end_row; ++v_index)
+    {
+        const float v = canvas->vertical_start + (float)(v_index) * dv;
+        const unsigned int row = v_index * canvas->nx_pts;
+
+        for (start = 0; start < canvas->nx_pts; start += SURFACE_BATCH_SIZE)
+        {
+            /*  The last batch in the row may be shorter than the others.     */
+            const unsigned int remaining = canvas->nx_pts - start;
+            const unsigned int length =
+                remaining < SURFACE_BATCH_SIZE ? remaining
+                                               : SURFACE_BATCH_SIZE;
+
+            /*  Index of the first point of the batch in the mesh.            */
+            const unsigned int index = row + start;
+            unsigned int n;
+
+            for (n = 0; n < length; ++n)
+                u[n] = canvas->horizontal_start + (float)(start + n) * du;
+
+            /*  Planar meshes have the same layout as the batch, write        *
+             *  directly.                                                     */
+            if (canvas->layout == PlanarLayout)
+                f(u, v, length,
+                  x_plane + index, y_plane + index, z_plane + index);
+
+            else
+            {
+                f(u, v, length, x, y, z);
+                interleave_batch(canvas->mesh + 3U * index, x, y, z, length);
+            }
+        }
+        /*  End of loop over the batches in the row.                          */
+    }
+    /*  End of vertical for-loop.                                             */
+}
+/*  End of generate_batched_surface_rows.                                     */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_batched_surface_mesh                                         *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a batched parametrization (u, v) *
+ *      -> (x, y, z).                                                         *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const ParametricSurfaceBatch):                                     *
+ *          The function that defines the surface, evaluated a row at a time. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The grid is sampled the same way as in generate_surface_mesh. Planar  *
+ *      meshes are written to directly by the surface. For interleaved meshes *
+ *      the surface writes to scratch arrays which are then interleaved into  *
+ *      the mesh.                                                             *
+ ******************************************************************************/
+void
+generate_batched_surface_mesh(Canvas * const canvas,
+                              const ParametricSurfaceBatch f)
+{
+    PROFILE_START;
+    parallel_rows(
+        canvas, generate_batched_surface_rows, &f, 0U, canvas->ny_pts
+    );
+    PROFILE_STOP(SurfaceMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_batched_surface_mesh.                                     */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef SURFACE_BATCH_SIZE
@@ -0,0 +1,70 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Generates the wireframe for a canvas, reusing the current one if      *
+ *      possible.                                                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and IndexTopology typedefs found here.                             */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_cached_wireframe                                             *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a canvas, skipping this if the index  *
+ *      buffer already holds them.                                            *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated, zero if it was      *
+ *          reused.                                                           *
+ *  Notes:                                                                    *
+ *      The line segments depend only on nx_pts, ny_pts, and mesh_type.       *
+ *      Changing the surface or the domain, for example with a slider, only   *
+ *      requires the vertices to be recomputed. The return value tells        *
+ *      JavaScript whether the index attribute needs to be uploaded again.    *
+ ******************************************************************************/
+unsigned int generate_cached_wireframe(Canvas * const canvas)
+{
+    /*  The topology the index buffer was last generated for.                 */
+    const IndexTopology * const cached = &canvas->index_topology;
+
+    /*  If the shape of the grid has not changed, neither have the indices.   */
+    if (cached->nx_pts == canvas->nx_pts &&
+        cached->ny_pts == canvas->ny_pts &&
+        cached->mesh_type == canvas->mesh_type)
+        return 0U;
+
+    /*  Otherwise compute the line segments and remember the new topology.    */
+    generate_wireframe(canvas);
+    canvas->index_topology.nx_pts = canvas->nx_pts;
+    canvas->index_topology.ny_pts = canvas->ny_pts;
+    canvas->index_topology.mesh_type = canvas->mesh_type;
+    return 1U;
+}
+/*  End of generate_cached_wireframe.                                         */
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes a band of rows of a mesh, for rendering large meshes         *
+ *      progressively.                                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, CanvasBand, and SurfaceParametrization typedefs found here.       */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  run_canvas_band and the kernels for the C API provided here.              */
+#include <threetools/parametric.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_band                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the next few rows of a mesh for a surface of the form z =    *
+ *      f(x, y), so that a large mesh can be drawn while it is still being    *
+ *      generated.                                                            *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being generated, from allocate_canvas or create_canvas.*
+ *      f (const SurfaceParametrization):                                     *
+ *          The function z = f(x, y) defining the surface.                    *
+ *      first_row (unsigned int):                                             *
+ *          The first row of the band, zero for the first band, and end_row of*
+ *          the previous band after that.                                     *
+ *      rows (unsigned int):                                                  *
+ *          The height of the band, in rows.                                  *
+ *  Output:                                                                   *
+ *      band (CanvasBand):                                                    *
+ *          The rows that were computed and the ranges of the output and index*
+ *          buffers that changed or became drawable.                          *
+ *  Notes:                                                                    *
+ *      The bands must be generated in order, from the first row, before the  *
+ *      mesh is rotated. Draw the first index_start + index_count indices     *
+ *      after each band.                                                      *
+ ******************************************************************************/
+CanvasBand
+generate_canvas_band(Canvas * const canvas,
+                     const SurfaceParametrization f,
+                     unsigned int first_row,
+                     unsigned int rows)
+{
+    /*  The surface is passed by address, see evaluate_parametrization.       */
+    const ParametricKernels kernels = parametrization_kernels();
+    return run_canvas_band(canvas, &kernels, &f, first_row, rows);
+}
+/*  End of generate_canvas_band.                                              */
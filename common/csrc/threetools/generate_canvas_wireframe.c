@@ -0,0 +1,60 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the mesh and wireframe for an already allocated canvas.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and SurfaceParametrization typedefs provided here.                 */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/*  run_canvas_wireframe and the kernels for the C API provided here.         */
+#include <threetools/parametric.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_wireframe                                             *
+ *  Purpose:                                                                  *
+ *      Creates a wireframe, of the canvas's mesh type, stored in a canvas.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      surface (const SurfaceParametrization):                               *
+ *          The parametrization, a function of the form z = f(x, y).          *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ *  Notes:                                                                    *
+ *      The vertices are always recomputed. The line segments are only        *
+ *      recomputed if the shape of the grid has changed.                      *
+ ******************************************************************************/
+unsigned int
+generate_canvas_wireframe(Canvas * const canvas,
+                          const SurfaceParametrization surface)
+{
+    /*  The surface is passed by address, see evaluate_parametrization.       */
+    const ParametricKernels kernels = parametrization_kernels();
+    return run_canvas_wireframe(canvas, &kernels, &surface);
+}
+/*  End of generate_canvas_wireframe.                                         */
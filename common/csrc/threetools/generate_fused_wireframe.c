@@ -0,0 +1,65 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the vertices and the square wireframe of a mesh in a single  *
+ *      pass.                                                                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and SurfaceParametrization typedefs found here.                    */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  run_fused_wireframe and the kernels for the C API provided here.          */
+#include <threetools/parametric.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_fused_wireframe                                              *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe for a surface of the form z = f(x, y),     *
+ *      computing the vertices and line segments of each row together.        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      f (const SurfaceParametrization):                                     *
+ *          The function z = f(x, y) defining the surface.                    *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ *  Notes:                                                                    *
+ *      This gives the same buffers as generate_parametric_mesh followed by   *
+ *      generate_cached_wireframe, in one pass over the grid instead of two.  *
+ *      Only square wireframes are fused. Other mesh types, and index buffers *
+ *      that are already up to date, use the two separate passes. The output  *
+ *      buffer and the normals are updated afterwards, as in                  *
+ *      generate_canvas_wireframe.                                            *
+ ******************************************************************************/
+unsigned int
+generate_fused_wireframe(Canvas * const canvas, const SurfaceParametrization f)
+{
+    /*  The surface is passed by address, see evaluate_parametrization.       */
+    const ParametricKernels kernels = parametrization_kernels();
+    return run_fused_wireframe(canvas, &kernels, &f);
+}
+/*  End of generate_fused_wireframe.                                          */
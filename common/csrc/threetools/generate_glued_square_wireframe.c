@@ -0,0 +1,235 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Generates square wireframes for cylinders, tori, and other glued      *
+ *      surfaces.                                                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and EdgeGluing typedefs found here.                                */
+#include <threetools/types.h>
+
+/*  GridPoint typedef and the glue_right and glue_up helpers provided here.   */
+#include <threetools/gluing.h>
+
+/*  store_line_segment helper provided here.                                  */
+#include <threetools/indices.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_glued_square_rows                                            *
+ *  Purpose:                                                                  *
+ *      Generates the line segments based at the points in a band of rows.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to an array of two EdgeGluing values, the horizontal and  *
+ *          vertical gluings.                                                 *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+generate_glued_square_rows(Canvas * const canvas,
+                           const void * const data,
+                           unsigned int first_row,
+                           unsigned int end_row)
+{
+    /*  The horizontal and vertical gluings are passed as an array.           */
+    const EdgeGluing * const gluings = data;
+    const EdgeGluing horizontal = gluings[0];
+    const EdgeGluing vertical = gluings[1];
+
+    /*  Variables for indexing the horizontal and vertical axes.              */
+    unsigned int x_index, y_index;
+
+    /*  Rows have nx_pts horizontal segments if the left and right edges are  *
+     *  glued, and nx_pts - 1 otherwise.                                      */
+    const unsigned int horizontal_segments =
+        (horizontal == NoGluing ? canvas->nx_pts - 1U : canvas->nx_pts);
+
+    /*  Every row but the last has the vertical segments and the horizontal   *
+     *  segments. A band starts at first_row times the size of such a row,    *
+     *  two indices per segment. Only the last row, which has no vertical     *
+     *  segments if the top edge is not glued, may be shorter.                */
+    const unsigned int row_size = 2U * (canvas->nx_pts + horizontal_segments);
+
+    /*  Variable for indexing over the array being written to.                */
+    unsigned int index = first_row * row_size;
+
+    /*  Loop over the grid in row-major fashion, the same order the vertices  *
+     *  are stored in. Each vertex is connected to its neighbors above it and *
+     *  to its right, wrapping across glued edges.                            */
+    for (y_index = first_row; y_index < end_row; ++y_index)
+    {
+        for (x_index = 0; x_index < canvas->nx_pts; ++x_index)
+        {
+            const GridPoint point = {x_index, y_index};
+            const unsigned int index00 = grid_index(canvas, point);
+
+            /*  The neighbors are found by moving the point across the grid.  */
+            GridPoint up = point;
+            GridPoint right = point;
+
+            /*  Line segment from the current point to the one above it.      */
+            if (glue_up(canvas, vertical, &up))
+            {
+                const unsigned int index10 = grid_index(canvas, up);
+                store_line_segment(canvas, index, index00, index10);
+                index += 2U;
+            }
+
+            /*  Line segment from the current point to the one on its right.  */
+            if (glue_right(canvas, horizontal, &right))
+            {
+                const unsigned int index01 = grid_index(canvas, right);
+                store_line_segment(canvas, index, index00, index01);
+                index += 2U;
+            }
+        }
+        /*  End of horizontal for-loop.                                       */
+    }
+    /*  End of vertical for-loop.                                             */
+}
+/*  End of generate_glued_square_rows.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_projective_square_top_row                                    *
+ *  Purpose:                                                                  *
+ *      Generates the line segments based at the points in the top row of a   *
+ *      projective plane.                                                     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Twisting both pairs of edges makes the top-left and bottom-right      *
+ *      corners neighbors both vertically and horizontally, and the same for  *
+ *      the top-right and bottom-left corners. The segment going up from the  *
+ *      top-left corner is the one going right from the bottom-right corner,  *
+ *      and the segment going right from the top-right corner is the one      *
+ *      going up from it. Each is stored once. This row is kept out of        *
+ *      generate_glued_square_rows so the loop for the others is unchanged.   *
+ ******************************************************************************/
+static void generate_projective_square_top_row(Canvas * const canvas)
+{
+    /*  Variable for indexing the horizontal axis.                            */
+    unsigned int x_index;
+
+    /*  Both gluings are twisted, every row before this one has nx_pts        *
+     *  vertical segments and nx_pts horizontal ones.                         */
+    const unsigned int y_index = canvas->ny_pts - 1U;
+    unsigned int index = y_index * 4U * canvas->nx_pts;
+
+    for (x_index = 0; x_index < canvas->nx_pts; ++x_index)
+    {
+        const GridPoint point = {x_index, y_index};
+        const unsigned int index00 = grid_index(canvas, point);
+
+        /*  The neighbors are found by moving the point across the grid.      */
+        GridPoint up = point;
+        GridPoint right = point;
+
+        /*  Line segment from the current point to the one above it, which    *
+         *  the bottom-right corner stores for the top-left corner.           */
+        if (x_index > 0U)
+        {
+            glue_up(canvas, TwistedGluing, &up);
+            store_line_segment(canvas, index, index00, grid_index(canvas, up));
+            index += 2U;
+        }
+
+        /*  Line segment from the current point to the one on its right. For  *
+         *  the top-right corner this is the segment stored just above.       */
+        if (x_index + 1U < canvas->nx_pts)
+        {
+            glue_right(canvas, TwistedGluing, &right);
+            store_line_segment(
+                canvas, index, index00, grid_index(canvas, right)
+            );
+
+            index += 2U;
+        }
+    }
+    /*  End of horizontal for-loop.                                           */
+}
+/*  End of generate_projective_square_top_row.                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_glued_square_wireframe                                       *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a grid of squares whose opposite edges*
+ *      may be glued together.                                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      horizontal (EdgeGluing):                                              *
+ *          How the right edge of the grid is glued to the left edge.         *
+ *      vertical (EdgeGluing):                                                *
+ *          How the top edge of the grid is glued to the bottom edge.         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each vertex is the base of the edge going up and the edge going right,*
+ *      provided these exist. The number of segments matches                  *
+ *      compute_index_size for the corresponding mesh types.                  *
+ ******************************************************************************/
+void
+generate_glued_square_wireframe(Canvas * const canvas,
+                                EdgeGluing horizontal,
+                                EdgeGluing vertical)
+{
+    /*  The kernels all take a single data pointer, pack the gluings.         */
+    const EdgeGluing gluings[2] = {horizontal, vertical};
+    PROFILE_START;
+
+    /*  The top row of a projective plane skips two segments that are stored  *
+     *  elsewhere, it is generated on its own after the others.               */
+    if (horizontal == TwistedGluing && vertical == TwistedGluing)
+    {
+        parallel_rows(
+            canvas, generate_glued_square_rows, gluings, 0U, canvas->ny_pts - 1U
+        );
+
+        generate_projective_square_top_row(canvas);
+    }
+
+    else
+        parallel_rows(
+            canvas, generate_glued_square_rows, gluings, 0U, canvas->ny_pts
+        );
+
+    PROFILE_STOP(WireframeKernel, canvas->number_of_points);
+}
+/*  End of generate_glued_square_wireframe.                                   */
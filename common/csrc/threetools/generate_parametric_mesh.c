@@ -41,47 +41,12 @@
  *          The function that defines the surface, z = f(x, y).               *
  *  Output:                                                                   *
  *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The points are written in the layout specified by the canvas.         *
  ******************************************************************************/
 void
 generate_parametric_mesh(Canvas * const canvas, const SurfaceParametrization f)
 {
-    /*  Step sizes in the horizontal and vertical axes.                       */
-    const float dx = canvas->width / (float)(canvas->nx_pts - 1U);
-    const float dy = canvas->height / (float)(canvas->ny_pts - 1U);
-
-    /*  Variables for indexing the horizontal and vertical axes.              */
-    unsigned int x_index, y_index;
-
-    /*  Variable for indexing over the array being written to.                */
-    unsigned int index = 0;
-
-    /*  Loop over the vertical axis. The surface is of the form z = f(x, y).  *
-     *  Note, since the y index is the outer for-loop, the array is indexed   *
-     *  in row-major fashion. That is, index = y * width + x.                 */
-    for (y_index = 0; y_index < canvas->ny_pts; ++y_index)
-    {
-        /*  Convert pixel index to y coordinate.                              */
-        const float y = canvas->vertical_start + (float)(y_index) * dy;
-
-        /*  Loop through the horizontal component of the object.              */
-        for (x_index = 0; x_index < canvas->nx_pts; ++x_index)
-        {
-            /*  Convert pixel index to x coordinate in the plane.             */
-            const float x = canvas->horizontal_start + (float)(x_index) * dx;
-
-            /*  Get the z component using the provided parametrization.       */
-            const float z = f(x, y);
-
-            /*  Add this point to our vertex array.                           */
-            canvas->mesh[index] = x;
-            canvas->mesh[index + 1U] = y;
-            canvas->mesh[index + 2U] = z;
-
-            /*  Move on to the next point in the mesh. A point needs 3 floats.*/
-            index += 3;
-        }
-        /*  End of horizontal for-loop.                                       */
-    }
-    /*  End of vertical for-loop.                                             */
+    generate_parametric_mesh_rows(canvas, f, 0U, canvas->ny_pts);
 }
 /*  End of generate_parametric_mesh.                                          */
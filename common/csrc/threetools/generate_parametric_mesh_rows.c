@@ -0,0 +1,68 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the locations of the points in a range of rows of the mesh   *
+ *      for a surface.                                                        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and SurfaceParametrization typedefs found here.                    */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  run_parametric_rows and the kernels for the C API provided here.          */
+#include <threetools/parametric.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_parametric_mesh_rows                                         *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a range of rows of a mesh from a parametric  *
+ *      equation.                                                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const SurfaceParametrization):                                     *
+ *          The function that defines the surface, z = f(x, y).               *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is computed.                                   *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is computed.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The other rows of the mesh are left untouched. This is used by        *
+ *      update_canvas to only compute the rows that have changed. If the      *
+ *      canvas has a color map, the rows are colored by height as well.       *
+ ******************************************************************************/
+void
+generate_parametric_mesh_rows(Canvas * const canvas,
+                              const SurfaceParametrization f,
+                              unsigned int first_row,
+                              unsigned int end_row)
+{
+    /*  The surface is passed by address, see evaluate_parametrization.       */
+    const ParametricKernels kernels = parametrization_kernels();
+    run_parametric_rows(canvas, &kernels, &f, first_row, end_row);
+}
+/*  End of generate_parametric_mesh_rows.                                     */
@@ -26,81 +26,71 @@
 /*  Canvas typedef found here.                                                */
 #include <threetools/types.h>
 
-/*  The MAX_WIDTH and MAX_HEIGHT macros are defined here.                     */
-#include <threetools/globals.h>
+/*  store_rectangular_row helper provided here.                               */
+#include <threetools/indices.h>
 
 /*  Function prototype / forward declaration given here.                      */
 #include <threetools/threetools.h>
 
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
 /******************************************************************************
  *  Function:                                                                 *
- *      generate_rectangular_wireframe                                        *
+ *      generate_rectangular_rows                                             *
  *  Purpose:                                                                  *
- *      Generates the line segments for a parametrized surface using          *
- *      a rectangular grid for a surface of the form z = f(x, y).             *
+ *      Generates the line segments based at the points in a band of rows.    *
  *  Arguments:                                                                *
  *      canvas (Canvas * const):                                              *
  *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Unused, the square pattern needs no extra data.                   *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
  *  Output:                                                                   *
  *      None (void).                                                          *
  ******************************************************************************/
-void generate_rectangular_wireframe(Canvas * const canvas)
+static void
+generate_rectangular_rows(Canvas * const canvas,
+                          const void * const data,
+                          unsigned int first_row,
+                          unsigned int end_row)
 {
-    /*  Variables for indexing the horizontal and vertical axes.              */
-    unsigned int x_index, y_index;
+    /*  Variable for indexing the vertical axis.                              */
+    unsigned int y_index;
 
-    /*  Variable for indexing over the array being written to.                */
-    unsigned int index = 0;
+    /*  The square pattern needs no extra data.                               */
+    (void)data;
 
     /*  We need to create the lines now. We do this by creating ordered       *
      *  pairs of the indices for the vertices in the vertex array that we     *
      *  want to connect. Each point will be connected to its four surrounding *
      *  neighbors, except for the points on the boundary, which have fewer    *
-     *  neighbors. We handle these boundary points separately.                */
-    for (y_index = 0; y_index < canvas->ny_pts; ++y_index)
-    {
-        /*  The indices are row-major, meaning index = y * width + x. The     *
-         *  shift factor only depends on the y-component, compute this.       */
-        const unsigned int shift = y_index * canvas->nx_pts;
-
-        /*  The vertical component is now fixed, loop through the horizontal. */
-        for (x_index = 0; x_index < canvas->nx_pts; ++x_index)
-        {
-            /*  The current index is the shift plus horizontal index. That    *
-             *  is, the index for (x, y) is y * width + x.                    */
-            const unsigned int index00 = shift + x_index;
-
-            /*  The point directly after the current point, in the horizontal.*/
-            const unsigned int  index01 = index00 + 1U;
-
-            /*  The point directly above the current point, in the vertical.  */
-            const unsigned int  index10 = index00 + canvas->nx_pts;
-
-            /*  If we are not at the top edge or the right edge of the        *
-             *  rectangle, we may add an "L" shape to our mesh connecting the *
-             *  bottom left point to the bottom right point, and the bottom   *
-             *  left point to the upper left point. At the top of the         *
-             *  rectangle the upper left point goes beyond the bounds of the  *
-             *  parametrization, so we do not need to draw it. Check for this.*/
-            if (y_index != canvas->ny_pts - 1U)
-            {
-                canvas->indices[index] = index00;
-                canvas->indices[index + 1U] = index10;
-                index += 2U;
-            }
+     *  neighbors. These are handled by store_rectangular_row, which writes   *
+     *  each row to its place in the index buffer.                            */
+    for (y_index = first_row; y_index < end_row; ++y_index)
+        store_rectangular_row(canvas, y_index);
+}
+/*  End of generate_rectangular_rows.                                         */
 
-            /*  Similarly, at the right edge we have that the bottom right    *
-             *  point lies outside of the parametrization and do not need to  *
-             *  add it to our mesh. Check for this.                           */
-            if (x_index != canvas->nx_pts - 1U)
-            {
-                canvas->indices[index] = index00;
-                canvas->indices[index + 1U] = index01;
-                index += 2U;
-            }
-        }
-        /*  End of horizontal for-loop.                                       */
-    }
-    /*  End of vertical for-loop.                                             */
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_rectangular_wireframe                                        *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a parametrized surface using          *
+ *      a rectangular grid for a surface of the form z = f(x, y).             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+void generate_rectangular_wireframe(Canvas * const canvas)
+{
+    PROFILE_START;
+    parallel_rows(canvas, generate_rectangular_rows, NULL, 0U, canvas->ny_pts);
+    PROFILE_STOP(WireframeKernel, canvas->number_of_points);
 }
 /*  End of generate_rectangular_wireframe.                                    */
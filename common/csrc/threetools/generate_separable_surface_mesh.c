@@ -0,0 +1,128 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a separable surface from tables of axis      *
+ *      samples.                                                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, SeparableSurface, and AxisSample typedefs found here.             */
+#include <threetools/types.h>
+
+/*  store_separable_rows and SeparableEvaluator provided here.                */
+#include <threetools/rows.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_separable                                                    *
+ *  Purpose:                                                                  *
+ *      Evaluates a SeparableSurface passed by address.                       *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the SeparableSurface defining the surface.             *
+ *      u (const AxisSample * const):                                         *
+ *          The sample of the horizontal parameter.                           *
+ *      v (const AxisSample * const):                                         *
+ *          The sample of the vertical parameter.                             *
+ *  Output:                                                                   *
+ *      point (Vec3):                                                         *
+ *          The point of the surface at (u, v).                               *
+ *  Notes:                                                                    *
+ *      Function pointers can not be stored in a void pointer.                *
+ ******************************************************************************/
+static Vec3
+evaluate_separable(const void * const data,
+                   const AxisSample * const u,
+                   const AxisSample * const v)
+{
+    const SeparableSurface f = *(const SeparableSurface *)data;
+    return f(u, v);
+}
+/*  End of evaluate_separable.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_separable_surface_rows                                       *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a band of rows of a separable surface.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the SeparableSurface defining the surface.             *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+generate_separable_surface_rows(Canvas * const canvas,
+                                const void * const data,
+                                unsigned int first_row,
+                                unsigned int end_row)
+{
+    store_separable_rows(
+        canvas, evaluate_separable, data, first_row, end_row
+    );
+}
+/*  End of generate_separable_surface_rows.                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_separable_surface_mesh                                       *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a separable surface, with the    *
+ *      trig values of each axis computed once.                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const SeparableSurface):                                           *
+ *          The function that defines the surface, in terms of the samples of *
+ *          u and v.                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The grid is sampled the same way as in generate_surface_mesh. Surfaces*
+ *      like the torus evaluate the cosine and sine of u and v at every point,*
+ *      which is 4 nx ny trig calls for the whole mesh. Here the samples of u *
+ *      are computed once per band of rows and those of v once per row, which *
+ *      is about 2 (nx + ny) calls when there is one thread. The points match *
+ *      generate_surface_mesh up to rounding in the double angle formulas.    *
+ ******************************************************************************/
+void
+generate_separable_surface_mesh(Canvas * const canvas,
+                                const SeparableSurface f)
+{
+    PROFILE_START;
+    parallel_rows(
+        canvas, generate_separable_surface_rows, &f, 0U, canvas->ny_pts
+    );
+    PROFILE_STOP(SurfaceMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_separable_surface_mesh.                                   */
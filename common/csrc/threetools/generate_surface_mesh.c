@@ -0,0 +1,116 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a general parametrization.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, ParametricSurface, and Vec3 typedefs found here.                  */
+#include <threetools/types.h>
+
+/*  store_surface_rows and PointEvaluator provided here.                      */
+#include <threetools/rows.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_surface                                                      *
+ *  Purpose:                                                                  *
+ *      Evaluates a ParametricSurface passed by address.                      *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the ParametricSurface defining the surface.            *
+ *      u (float):                                                            *
+ *          The horizontal parameter.                                         *
+ *      v (float):                                                            *
+ *          The vertical parameter.                                           *
+ *  Output:                                                                   *
+ *      point (Vec3):                                                         *
+ *          The point of the surface at (u, v).                               *
+ *  Notes:                                                                    *
+ *      Function pointers can not be stored in a void pointer.                *
+ ******************************************************************************/
+static Vec3 evaluate_surface(const void * const data, float u, float v)
+{
+    const ParametricSurface f = *(const ParametricSurface *)data;
+    return f(u, v);
+}
+/*  End of evaluate_surface.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_surface_rows                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a band of rows of a mesh (u, v) -> (x, y, z).*
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the ParametricSurface defining the surface.            *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+generate_surface_rows(Canvas * const canvas,
+                      const void * const data,
+                      unsigned int first_row,
+                      unsigned int end_row)
+{
+    store_surface_rows(canvas, evaluate_surface, data, first_row, end_row);
+}
+/*  End of generate_surface_rows.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_surface_mesh                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a parametrization (u, v) -> (x,  *
+ *      y, z).                                                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const ParametricSurface):                                          *
+ *          The function that defines the surface.                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The horizontal axis of the canvas is u, and the vertical axis is v.   *
+ *      Axes that are glued by the mesh type are sampled periodically, so for *
+ *      a torus with u in [0, 2 pi) the last column of points does not repeat *
+ *      the first. The points are written in the layout specified by the      *
+ *      canvas.                                                               *
+ ******************************************************************************/
+void generate_surface_mesh(Canvas * const canvas, const ParametricSurface f)
+{
+    PROFILE_START;
+    parallel_rows(canvas, generate_surface_rows, &f, 0U, canvas->ny_pts);
+    PROFILE_STOP(SurfaceMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_surface_mesh.                                             */
@@ -0,0 +1,98 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a tube around a curve with rotation-         *
+ *      minimizing frames.                                                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, ParametricCurve, and Vec3 typedefs found here.                    */
+#include <threetools/types.h>
+
+/*  store_tube_rows and CurveEvaluator provided here.                         */
+#include <threetools/tube.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_curve                                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates a ParametricCurve passed by address.                        *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the ParametricCurve at the center of the tube.         *
+ *      t (float):                                                            *
+ *          The parameter of the point.                                       *
+ *  Output:                                                                   *
+ *      point (Vec3):                                                         *
+ *          The point of the curve at t.                                      *
+ *  Notes:                                                                    *
+ *      Function pointers can not be stored in a void pointer.                *
+ ******************************************************************************/
+static Vec3 evaluate_curve(const void * const data, float t)
+{
+    const ParametricCurve curve = *(const ParametricCurve *)data;
+    return curve(t);
+}
+/*  End of evaluate_curve.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_tube_mesh                                                    *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a tube of constant radius around a curve.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      curve (const ParametricCurve):                                        *
+ *          The curve at the center of the tube.                              *
+ *      radius (float):                                                       *
+ *          The radius of the tube.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each row of the canvas is a circle about one point of the curve, the  *
+ *      vertical axis is the parameter of the curve and the horizontal axis is*
+ *      the angle around the circle, which should have a width of 2 pi.       *
+ *      CylindricalSquareWireframe gives a tube around an open curve,         *
+ *      TorodialSquareWireframe around a closed one, and compute_index_size   *
+ *      already sizes both. The frames are rotation-minimizing, so the tube   *
+ *      does not twist the way Frenet frames do near inflection points. A     *
+ *      closed curve makes a first pass to find how far the frame turns on the*
+ *      way around, and the twist is spread evenly over the rows so the tube  *
+ *      closes up. The frames are carried from one row to the next, so the    *
+ *      rows are not split across threads.                                    *
+ ******************************************************************************/
+void
+generate_tube_mesh(Canvas * const canvas,
+                   const ParametricCurve curve,
+                   float radius)
+{
+    PROFILE_START;
+    store_tube_rows(canvas, evaluate_curve, &curve, radius);
+    PROFILE_STOP(TubeMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_tube_mesh.                                                */
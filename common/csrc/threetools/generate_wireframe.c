@@ -0,0 +1,134 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a canvas based on its mesh type.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, EdgeGluing, and MeshType typedefs found here.                     */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_wireframe                                                    *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a canvas, using its mesh type.        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The left and right edges of the grid are the ones glued for cylinders *
+ *      and Mobius strips. The projective plane identifies opposite corners of*
+ *      the grid, so the two segments joining them would be stored twice and, *
+ *      for triangles, one diagonal would start and end at the same vertex.   *
+ *      Its top row is generated on its own, storing each of these segments   *
+ *      once and skipping the diagonal, and compute_index_size counts exactly *
+ *      what is written. Illegal mesh types have an index size of zero,       *
+ *      nothing is written for these.                                         *
+ ******************************************************************************/
+void generate_wireframe(Canvas * const canvas)
+{
+    switch (canvas->mesh_type)
+    {
+        /*  The basic square pattern has its own, slightly simpler, routine.  */
+        case SquareWireframe:
+            generate_rectangular_wireframe(canvas);
+            break;
+
+        case TriangleWireframe:
+            generate_glued_triangle_wireframe(canvas, NoGluing, NoGluing);
+            break;
+
+        /*  Cylinders glue the left and right edges, keeping the orientation. */
+        case CylindricalSquareWireframe:
+            generate_glued_square_wireframe(canvas, StraightGluing, NoGluing);
+            break;
+
+        case CylindricalTriangleWireframe:
+            generate_glued_triangle_wireframe(canvas, StraightGluing, NoGluing);
+            break;
+
+        /*  Mobius strips glue the left and right edges with a half twist.    */
+        case MobiusSquareWireframe:
+            generate_glued_square_wireframe(canvas, TwistedGluing, NoGluing);
+            break;
+
+        case MobiusTriangleWireframe:
+            generate_glued_triangle_wireframe(canvas, TwistedGluing, NoGluing);
+            break;
+
+        /*  The torus glues both pairs of edges, keeping the orientation.     */
+        case TorodialSquareWireframe:
+            generate_glued_square_wireframe(
+                canvas, StraightGluing, StraightGluing
+            );
+
+            break;
+
+        case TorodialTriangleWireframe:
+            generate_glued_triangle_wireframe(
+                canvas, StraightGluing, StraightGluing
+            );
+
+            break;
+
+        /*  The Klein bottle is a Mobius strip whose boundary is glued to     *
+         *  itself, the top and bottom edges are glued straight.              */
+        case KleinSquareWireframe:
+            generate_glued_square_wireframe(
+                canvas, TwistedGluing, StraightGluing
+            );
+
+            break;
+
+        case KleinTriangleWireframe:
+            generate_glued_triangle_wireframe(
+                canvas, TwistedGluing, StraightGluing
+            );
+
+            break;
+
+        /*  The projective plane twists both pairs of edges.                  */
+        case ProjectiveSquareWireframe:
+            generate_glued_square_wireframe(
+                canvas, TwistedGluing, TwistedGluing
+            );
+
+            break;
+
+        case ProjectiveTriangleWireframe:
+            generate_glued_triangle_wireframe(
+                canvas, TwistedGluing, TwistedGluing
+            );
+
+            break;
+
+        /*  Illegal input, the index size is zero so there is nothing to do.  */
+        default:
+            break;
+    }
+}
+/*  End of generate_wireframe.                                                */
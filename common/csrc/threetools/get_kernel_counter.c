@@ -0,0 +1,59 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns the profiling counters for a kernel.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The kernel_counters global is declared here.                              */
+#include <threetools/globals.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      get_kernel_counter                                                    *
+ *  Purpose:                                                                  *
+ *      Returns the number of calls, points processed, and total time for a   *
+ *      kernel.                                                               *
+ *  Arguments:                                                                *
+ *      kernel (ProfileKernel):                                               *
+ *          The kernel whose counters are wanted.                             *
+ *  Output:                                                                   *
+ *      counter (KernelCounter):                                              *
+ *          The counters since the last call to reset_kernel_counters.        *
+ *  Notes:                                                                    *
+ *      The counters are always zero unless the library is built with         *
+ *      THREETOOLS_PROFILE, see profiling_enabled. Invalid kernels also get   *
+ *      zeros.                                                                *
+ ******************************************************************************/
+KernelCounter get_kernel_counter(ProfileKernel kernel)
+{
+    /*  Returned for kernels outside of the enum.                             */
+    const KernelCounter zero = {0.0, 0.0, 0.0};
+
+    if ((unsigned int)kernel >= PROFILE_KERNEL_COUNT)
+        return zero;
+
+    return kernel_counters[kernel];
+}
+/*  End of get_kernel_counter.                                                */
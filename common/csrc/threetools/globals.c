@@ -32,11 +32,14 @@
 /*  The rotation vector, initially set to the x axis (no rotation).           */
 UnitVector rotation_vector = {1.0, 0.0};
 
-/*  The main canvas for animations. Not initialized at the start.             */
-Canvas main_canvas;
+/*  The rotation angle between frames, initially zero (no rotation).          */
+float rotation_angle = 0.0F;
+
+/*  Mesh generation runs on the calling thread unless told otherwise.         */
+unsigned int thread_count = 1U;
 
-/*  Buffer for the vertices in the mesh.                                      */
-float mesh_buffer[MAX_MESH_BUFFER_SIZE];
+/*  Profiling counters, zero until something is timed.                        */
+KernelCounter kernel_counters[PROFILE_KERNEL_COUNT];
 
-/*  Buffer for the indices indicating which vertices are connected by a line. */
-unsigned int index_buffer[MAX_INDEX_BUFFER_SIZE];
+/*  The main canvas for animations. Zero-initialized, it owns no buffers.     */
+Canvas main_canvas;
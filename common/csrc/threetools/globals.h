@@ -35,37 +35,29 @@
 extern "C" {
 #endif
 
-/*  The max width and height (in terms of number of vertices) allowed.        */
-#define MAX_WIDTH (512U)
-#define MAX_HEIGHT (512U)
+/*  Globals for the rotation angle. We pre-compute the sine and cosine of     *
+ *  this when it is initialized to save us some redundant calculations.       */
+extern UnitVector rotation_vector;
 
-/*  The maximum total number of points allowed in the mesh.                   */
-#define MAX_NUMBER_OF_POINTS (MAX_WIDTH * MAX_HEIGHT)
+/*  The angle itself, used by canvases with absolute rotations.               */
+extern float rotation_angle;
 
-/*  The maximum number of floats needed for the mesh.                         */
-#define MAX_MESH_BUFFER_SIZE (3U * MAX_NUMBER_OF_POINTS)
+/*  The largest number of threads used for generating meshes.                 */
+#define MAX_THREAD_COUNT (16U)
 
-/*  The maximum number of indices in the index array, which is six times the  *
- *  maximum number of points that are used in the mesh. This occurs when we   *
- *  have a torus-like mesh that consists of triangles. Each vertex in the     *
- *  mesh corresponds to three line segments, and a line segment corresponds   *
- *  to two indices (the start and the end), so six times the number of points.*/
-#define MAX_INDEX_BUFFER_SIZE (6U * MAX_NUMBER_OF_POINTS)
+/*  The number of threads used for generating meshes. This is one, no         *
+ *  threading, unless the library is built with THREETOOLS_USE_PTHREADS and   *
+ *  set_thread_count is called.                                               */
+extern unsigned int thread_count;
 
-/*  Globals for the rotation angle. We pre-compute the sine and cosine of     *
- *  this when it is initialized to save us some redundant calculations.       */
-extern UnitVector rotation_vector;
+/*  Counters for the kernels, indexed by ProfileKernel. These are only        *
+ *  written to by builds with THREETOOLS_PROFILE, and are zero otherwise.     */
+extern KernelCounter kernel_counters[PROFILE_KERNEL_COUNT];
 
-/*  Primary canvas for most animations. Contains pointers to the mesh and     *
- *  index buffers provided below.                                             */
+/*  Primary canvas for most animations. Its buffers are allocated on the heap *
+ *  by init_main_canvas, sized for the requested grid.                        */
 extern Canvas main_canvas;
 
-/*  Arrays for the mesh, which contains the points in the surface, and the    *
- *  index array, which specifies the line segments. These are fixed-width     *
- *  arrays created at compile time. No calls to malloc or free needed.        */
-extern float mesh_buffer[MAX_MESH_BUFFER_SIZE];
-extern unsigned int index_buffer[MAX_INDEX_BUFFER_SIZE];
-
 /*  End the extern "C" statement if a C++ compiler is being used.             */
 #ifdef __cplusplus
 }
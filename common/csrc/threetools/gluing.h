@@ -0,0 +1,320 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides helpers for finding the neighbors of a point in a glued grid.*
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_GLUING_H
+#define THREETOOLS_GLUING_H
+
+/*  Canvas, EdgeGluing, and MeshType typedefs provided here.                  */
+#include <threetools/types.h>
+
+/*  A point in the grid, given by its horizontal and vertical indices.        */
+typedef struct GridPoint {
+    unsigned int x, y;
+} GridPoint;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      grid_index                                                            *
+ *  Purpose:                                                                  *
+ *      Computes the index of a grid point in the mesh.                       *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas the point lies in.                                     *
+ *      point (GridPoint):                                                    *
+ *          The point in the grid.                                            *
+ *  Output:                                                                   *
+ *      index (unsigned int):                                                 *
+ *          The index of the point, which is row-major.                       *
+ ******************************************************************************/
+static inline unsigned int
+grid_index(const Canvas * const canvas, GridPoint point)
+{
+    return point.y * canvas->nx_pts + point.x;
+}
+/*  End of grid_index.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      glue_down                                                             *
+ *  Purpose:                                                                  *
+ *      Moves a point to its neighbor below it.                               *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas the point lies in.                                     *
+ *      gluing (EdgeGluing):                                                  *
+ *          How the top edge is glued to the bottom edge.                     *
+ *      point (GridPoint * const):                                            *
+ *          The point, which is moved to its neighbor.                        *
+ *  Output:                                                                   *
+ *      exists (unsigned int):                                                *
+ *          Non-zero if the neighbor exists, zero if the point is on an       *
+ *          unglued bottom edge. The point is undefined in this case.         *
+ ******************************************************************************/
+static inline unsigned int
+glue_down(const Canvas * const canvas,
+          EdgeGluing gluing,
+          GridPoint * const point)
+{
+    /*  Interior points, and points on the top edge, simply move down.        */
+    if (point->y > 0U)
+    {
+        --point->y;
+        return 1U;
+    }
+
+    /*  The point is on the bottom edge. Wrap around to the top edge,         *
+     *  flipping the horizontal axis for twisted gluings.                     */
+    point->y = canvas->ny_pts - 1U;
+
+    if (gluing == TwistedGluing)
+        point->x = canvas->nx_pts - 1U - point->x;
+
+    return gluing != NoGluing;
+}
+/*  End of glue_down.                                                         */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      glue_left                                                             *
+ *  Purpose:                                                                  *
+ *      Moves a point to its neighbor on the left.                            *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas the point lies in.                                     *
+ *      gluing (EdgeGluing):                                                  *
+ *          How the right edge is glued to the left edge.                     *
+ *      point (GridPoint * const):                                            *
+ *          The point, which is moved to its neighbor.                        *
+ *  Output:                                                                   *
+ *      exists (unsigned int):                                                *
+ *          Non-zero if the neighbor exists, zero if the point is on an       *
+ *          unglued left edge. The point is undefined in this case.           *
+ ******************************************************************************/
+static inline unsigned int
+glue_left(const Canvas * const canvas,
+          EdgeGluing gluing,
+          GridPoint * const point)
+{
+    /*  Interior points, and points on the right edge, simply move left.      */
+    if (point->x > 0U)
+    {
+        --point->x;
+        return 1U;
+    }
+
+    /*  The point is on the left edge. Wrap around to the right edge. The     *
+     *  twist is its own inverse, the vertical axis is flipped again.         */
+    point->x = canvas->nx_pts - 1U;
+
+    if (gluing == TwistedGluing)
+        point->y = canvas->ny_pts - 1U - point->y;
+
+    return gluing != NoGluing;
+}
+/*  End of glue_left.                                                         */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      glue_right                                                            *
+ *  Purpose:                                                                  *
+ *      Moves a point to its neighbor on the right.                           *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas the point lies in.                                     *
+ *      gluing (EdgeGluing):                                                  *
+ *          How the right edge is glued to the left edge.                     *
+ *      point (GridPoint * const):                                            *
+ *          The point, which is moved to its neighbor.                        *
+ *  Output:                                                                   *
+ *      exists (unsigned int):                                                *
+ *          Non-zero if the neighbor exists, zero if the point is on an       *
+ *          unglued right edge. The point is undefined in this case.          *
+ ******************************************************************************/
+static inline unsigned int
+glue_right(const Canvas * const canvas,
+           EdgeGluing gluing,
+           GridPoint * const point)
+{
+    /*  Interior points, and points on the left edge, simply move right.      */
+    if (point->x + 1U < canvas->nx_pts)
+    {
+        ++point->x;
+        return 1U;
+    }
+
+    /*  The point is on the right edge. Wrap around to the left edge,         *
+     *  flipping the vertical axis for twisted gluings.                       */
+    point->x = 0U;
+
+    if (gluing == TwistedGluing)
+        point->y = canvas->ny_pts - 1U - point->y;
+
+    return gluing != NoGluing;
+}
+/*  End of glue_right.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      glue_up                                                               *
+ *  Purpose:                                                                  *
+ *      Moves a point to its neighbor above it.                               *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas the point lies in.                                     *
+ *      gluing (EdgeGluing):                                                  *
+ *          How the top edge is glued to the bottom edge.                     *
+ *      point (GridPoint * const):                                            *
+ *          The point, which is moved to its neighbor.                        *
+ *  Output:                                                                   *
+ *      exists (unsigned int):                                                *
+ *          Non-zero if the neighbor exists, zero if the point is on an       *
+ *          unglued top edge. The point is undefined in this case.            *
+ ******************************************************************************/
+static inline unsigned int
+glue_up(const Canvas * const canvas, EdgeGluing gluing, GridPoint * const point)
+{
+    /*  Interior points, and points on the bottom edge, simply move up.       */
+    if (point->y + 1U < canvas->ny_pts)
+    {
+        ++point->y;
+        return 1U;
+    }
+
+    /*  The point is on the top edge. Wrap around to the bottom edge,         *
+     *  flipping the horizontal axis for twisted gluings.                     */
+    point->y = 0U;
+
+    if (gluing == TwistedGluing)
+        point->x = canvas->nx_pts - 1U - point->x;
+
+    return gluing != NoGluing;
+}
+/*  End of glue_up.                                                           */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      horizontal_gluing                                                     *
+ *  Purpose:                                                                  *
+ *      Returns how the left and right edges are glued for a mesh type.       *
+ *  Arguments:                                                                *
+ *      type (MeshType):                                                      *
+ *          The type of the mesh.                                             *
+ *  Output:                                                                   *
+ *      gluing (EdgeGluing):                                                  *
+ *          The gluing of the left and right edges.                           *
+ *  Notes:                                                                    *
+ *      This matches the gluings used by generate_wireframe.                  *
+ ******************************************************************************/
+static inline EdgeGluing horizontal_gluing(MeshType type)
+{
+    switch (type)
+    {
+        case CylindricalSquareWireframe:
+        case CylindricalTriangleWireframe:
+        case TorodialSquareWireframe:
+        case TorodialTriangleWireframe:
+            return StraightGluing;
+
+        case MobiusSquareWireframe:
+        case MobiusTriangleWireframe:
+        case KleinSquareWireframe:
+        case KleinTriangleWireframe:
+        case ProjectiveSquareWireframe:
+        case ProjectiveTriangleWireframe:
+            return TwistedGluing;
+
+        default:
+            return NoGluing;
+    }
+}
+/*  End of horizontal_gluing.                                                 */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      vertical_gluing                                                       *
+ *  Purpose:                                                                  *
+ *      Returns how the top and bottom edges are glued for a mesh type.       *
+ *  Arguments:                                                                *
+ *      type (MeshType):                                                      *
+ *          The type of the mesh.                                             *
+ *  Output:                                                                   *
+ *      gluing (EdgeGluing):                                                  *
+ *          The gluing of the top and bottom edges.                           *
+ *  Notes:                                                                    *
+ *      This matches the gluings used by generate_wireframe.                  *
+ ******************************************************************************/
+static inline EdgeGluing vertical_gluing(MeshType type)
+{
+    switch (type)
+    {
+        case TorodialSquareWireframe:
+        case TorodialTriangleWireframe:
+        case KleinSquareWireframe:
+        case KleinTriangleWireframe:
+            return StraightGluing;
+
+        case ProjectiveSquareWireframe:
+        case ProjectiveTriangleWireframe:
+            return TwistedGluing;
+
+        default:
+            return NoGluing;
+    }
+}
+/*  End of vertical_gluing.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      grid_step                                                             *
+ *  Purpose:                                                                  *
+ *      Computes the spacing between samples along one axis of the grid.      *
+ *  Arguments:                                                                *
+ *      length (float):                                                       *
+ *          The length of the domain along the axis.                          *
+ *      points (unsigned int):                                                *
+ *          The number of samples along the axis.                             *
+ *      gluing (EdgeGluing):                                                  *
+ *          How the two ends of the axis are glued.                           *
+ *  Output:                                                                   *
+ *      step (float):                                                         *
+ *          The distance between consecutive samples.                         *
+ *  Notes:                                                                    *
+ *      Unglued axes include both endpoints of the domain. Glued axes are     *
+ *      periodic, the last sample is one step before the end so that it does  *
+ *      not duplicate the first one.                                          *
+ ******************************************************************************/
+static inline float
+grid_step(float length, unsigned int points, EdgeGluing gluing)
+{
+    if (gluing == NoGluing)
+        return length / (float)(points - 1U);
+
+    return length / (float)points;
+}
+/*  End of grid_step.                                                         */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,244 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Straight-line homotopy between the meshes of two canvases, written to *
+ *      the output buffer.                                                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas typedef provided here.                                             */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/*  SIMD128 helpers, only used if compiled with -msimd128.                    */
+#include <threetools/simd.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      lerp_interleaved_to_output                                            *
+ *  Purpose:                                                                  *
+ *      Writes (1 - t) f + t g into the output buffer, where f and g are      *
+ *      interleaved meshes.                                                   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the start mesh, f, and the output buffer.         *
+ *      target (const Canvas * const):                                        *
+ *          The canvas with the end mesh, g.                                  *
+ *      t (float):                                                            *
+ *          The time parameter, between 0 and 1.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+lerp_interleaved_to_output(Canvas * const canvas,
+                           const Canvas * const target,
+                           float t)
+{
+    /*  Variable for indexing over the elements of the mesh.                  */
+    unsigned int index = 0U;
+
+    /*  The weight for the start mesh. Using (1 - t) f + t g, rather than     *
+     *  f + t (g - f), gives the endpoints exactly at t = 0 and t = 1.        */
+    const float s = 1.0F - t;
+
+#if defined(__wasm_simd128__)
+
+    /*  The weights are the same for every element, splat them.               */
+    const v128_t sv = wasm_f32x4_splat(s);
+    const v128_t tv = wasm_f32x4_splat(t);
+
+    /*  Both meshes and the output have the same layout, so the components    *
+     *  need not be separated. Work on four floats at a time.                 */
+    for (; index + 4U <= canvas->mesh_size; index += 4U)
+    {
+        const v128_t f = wasm_v128_load(canvas->mesh + index);
+        const v128_t g = wasm_v128_load(target->mesh + index);
+
+        wasm_v128_store(
+            canvas->output + index,
+            wasm_f32x4_add(wasm_f32x4_mul(sv, f), wasm_f32x4_mul(tv, g))
+        );
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) element in the mesh.                    */
+    for (; index < canvas->mesh_size; ++index)
+        canvas->output[index] =
+            s * canvas->mesh[index] + t * target->mesh[index];
+}
+/*  End of lerp_interleaved_to_output.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      lerp_planar_to_output                                                 *
+ *  Purpose:                                                                  *
+ *      Writes (1 - t) f + t g into the interleaved output buffer, where f and*
+ *      g are planar meshes. The read, blend, and interleave are fused into a *
+ *      single pass.                                                          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the start mesh, f, and the output buffer.         *
+ *      target (const Canvas * const):                                        *
+ *          The canvas with the end mesh, g.                                  *
+ *      t (float):                                                            *
+ *          The time parameter, between 0 and 1.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+lerp_planar_to_output(Canvas * const canvas,
+                      const Canvas * const target,
+                      float t)
+{
+    /*  Variable for indexing over the points in the mesh.                    */
+    unsigned int index = 0U;
+
+    /*  The weight for the start mesh, see lerp_interleaved_to_output.        */
+    const float s = 1.0F - t;
+
+    /*  Offsets to the y and z planes of both meshes.                         */
+    const unsigned int y_offset = canvas->number_of_points;
+    const unsigned int z_offset = 2U * y_offset;
+
+#if defined(__wasm_simd128__)
+
+    /*  The weights are the same for every element, splat them.               */
+    const v128_t sv = wasm_f32x4_splat(s);
+    const v128_t tv = wasm_f32x4_splat(t);
+
+    /*  Blend four points at a time. Each plane is contiguous.                */
+    for (; index + 4U <= canvas->number_of_points; index += 4U)
+    {
+        /*  The blended x, y, and z values, and the plane being blended.      */
+        v128_t blend[3];
+        unsigned int plane;
+
+        for (plane = 0U; plane < 3U; ++plane)
+        {
+            const unsigned int offset = plane * y_offset + index;
+            const v128_t f = wasm_v128_load(canvas->mesh + offset);
+            const v128_t g = wasm_v128_load(target->mesh + offset);
+
+            blend[plane] = wasm_f32x4_add(
+                wasm_f32x4_mul(sv, f), wasm_f32x4_mul(tv, g)
+            );
+        }
+
+        simd_store_xyz4(
+            canvas->output + 3U * index, blend[0], blend[1], blend[2]
+        );
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < canvas->number_of_points; ++index)
+    {
+        const unsigned int x_index = index;
+        const unsigned int y_index = index + y_offset;
+        const unsigned int z_index = index + z_offset;
+        float * const out = canvas->output + 3U * index;
+
+        out[0] = s * canvas->mesh[x_index] + t * target->mesh[x_index];
+        out[1] = s * canvas->mesh[y_index] + t * target->mesh[y_index];
+        out[2] = s * canvas->mesh[z_index] + t * target->mesh[z_index];
+    }
+}
+/*  End of lerp_planar_to_output.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      homotopy_canvas                                                       *
+ *  Purpose:                                                                  *
+ *      Computes the straight-line homotopy (1 - t) f + t g between the mesh  *
+ *      of one canvas and the mesh of another, and writes it to the output    *
+ *      buffer.                                                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the start mesh, f. This is the canvas that is     *
+ *          rendered.                                                         *
+ *      target (const Canvas * const):                                        *
+ *          The canvas with the end mesh, g.                                  *
+ *      t (float):                                                            *
+ *          The time parameter, usually between 0 and 1.                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The two endpoint meshes are computed once, using any of the mesh      *
+ *      generators, and neither is modified here. Both canvases must have the *
+ *      same grid and layout, otherwise nothing is done. If the output buffer *
+ *      of the canvas is its mesh, which is the case for interleaved meshes   *
+ *      rotated in place, the canvas is given its own output buffer first.    *
+ ******************************************************************************/
+void
+homotopy_canvas(Canvas * const canvas, const Canvas * const target, float t)
+{
+    /*  The points are paired up by their index, the grids must agree.        */
+    if (canvas->mesh_size != target->mesh_size)
+        return;
+
+    if (canvas->layout != target->layout)
+        return;
+
+    /*  The start mesh must not be overwritten. This happens at most once     *
+     *  per reallocation of the canvas, and not on every frame.               */
+    if (canvas->output == canvas->mesh)
+    {
+        reset_output_buffer(canvas, NULL);
+
+        /*  If the allocation failed, restore the canvas and give up.         */
+        if (!canvas->output)
+        {
+            reset_output_buffer(canvas, canvas->mesh);
+            return;
+        }
+    }
+
+    {
+        /*  Only the blend is timed, the normals and colors count themselves. */
+        PROFILE_START;
+
+        if (canvas->layout == PlanarLayout)
+            lerp_planar_to_output(canvas, target, t);
+
+        else
+            lerp_interleaved_to_output(canvas, target, t);
+
+        PROFILE_STOP(HomotopyKernel, canvas->number_of_points);
+    }
+
+    /*  Blending the normals of the two meshes would not give the normals of  *
+     *  the blend, they are recomputed from the new output instead. The same  *
+     *  goes for the colors, the heights have changed.                        */
+    compute_canvas_normals(canvas);
+    color_canvas(canvas);
+}
+/*  End of homotopy_canvas.                                                   */
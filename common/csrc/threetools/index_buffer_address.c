@@ -33,15 +33,16 @@
  *  Function:                                                                 *
  *      index_buffer_address                                                  *
  *  Purpose:                                                                  *
- *      Returns the address of the global index buffer.                       *
+ *      Returns the address of the index buffer of a canvas.                  *
  *  Arguments:                                                                *
  *      canvas (const Canvas * const).                                        *
  *          The canvas containing the index buffer that we want.              *
  *  Output:                                                                   *
- *      address (unsigned int *):                                             *
- *          The address of the global index buffer as a pointer.              *
+ *      address (void *):                                                     *
+ *          The address of the index buffer as a pointer. The elements are    *
+ *          unsigned short or unsigned int, see index_buffer_type.            *
  ******************************************************************************/
-unsigned int *index_buffer_address(const Canvas * const canvas)
+void *index_buffer_address(const Canvas * const canvas)
 {
     /*  We can simply return the index buffer. At the JavaScript level this   *
      *  is used to get the address of the index array for reading and writing.*/
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns the element type of the index buffer of a canvas.             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and IndexType typedefs found here.                                 */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      index_buffer_type                                                     *
+ *  Purpose:                                                                  *
+ *      Returns the element type of the index buffer.                         *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the index buffer.                           *
+ *  Output:                                                                   *
+ *      type (IndexType):                                                     *
+ *          Uint16Indices or Uint32Indices.                                   *
+ *  Notes:                                                                    *
+ *      This is used at the JavaScript level to pick between a Uint16Array and*
+ *      a Uint32Array view of the index buffer.                               *
+ ******************************************************************************/
+IndexType index_buffer_type(const Canvas * const canvas)
+{
+    return canvas->index_type;
+}
+/*  End of index_buffer_type.                                                 */
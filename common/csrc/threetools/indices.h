@@ -0,0 +1,175 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides a helper for writing to index buffers of either element type.*
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_INDICES_H
+#define THREETOOLS_INDICES_H
+
+/*  UINT_MAX macro provided here.                                             */
+#include <limits.h>
+
+/*  Canvas and IndexType typedefs provided here.                              */
+#include <threetools/types.h>
+
+/*  The largest number of vertices that may be addressed with 16-bit indices. *
+ *  WebGL2 always enables primitive restart, the index 0xFFFF ends the strip  *
+ *  rather than naming a vertex, so the last usable index is 65534. This      *
+ *  matches arrayNeedsUint32 in three.js.                                     */
+#define MAX_UINT16_INDEX_POINTS (65535U)
+
+/*  The largest number of points a canvas may have. The triangle wireframes   *
+ *  have the most elements per point, six indices, and the element counts of  *
+ *  every buffer must fit in an unsigned int.                                 */
+#define MAX_CANVAS_POINTS (UINT_MAX / 6U)
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      canvas_points_overflow                                                *
+ *  Purpose:                                                                  *
+ *      Checks if a grid has more points than a canvas may hold.              *
+ *  Arguments:                                                                *
+ *      nx_pts (unsigned int):                                                *
+ *          The number of points in the horizontal direction.                 *
+ *      ny_pts (unsigned int):                                                *
+ *          The number of points in the vertical direction.                   *
+ *  Output:                                                                   *
+ *      overflow (int):                                                       *
+ *          Non-zero if nx_pts * ny_pts exceeds MAX_CANVAS_POINTS.            *
+ *  Notes:                                                                    *
+ *      The product is never computed, it may wrap around.                    *
+ ******************************************************************************/
+static inline int
+canvas_points_overflow(unsigned int nx_pts, unsigned int ny_pts)
+{
+    return nx_pts != 0U && ny_pts > MAX_CANVAS_POINTS / nx_pts;
+}
+/*  End of canvas_points_overflow.                                            */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_line_segment                                                    *
+ *  Purpose:                                                                  *
+ *      Writes the two endpoints of a line segment to the index buffer.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose index buffer is being written to.                *
+ *      index (unsigned int):                                                 *
+ *          The position in the index buffer of the first endpoint.           *
+ *      start (unsigned int):                                                 *
+ *          The index of the first vertex of the line segment.                *
+ *      end (unsigned int):                                                   *
+ *          The index of the second vertex of the line segment.               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The index type is the same for every segment of a canvas, so the      *
+ *      branch is perfectly predicted.                                        *
+ ******************************************************************************/
+static inline void
+store_line_segment(Canvas * const canvas,
+                   unsigned int index,
+                   unsigned int start,
+                   unsigned int end)
+{
+    /*  The casts are needed in C++, this header is used by threetools.hpp.   */
+    if (canvas->index_type == Uint16Indices)
+    {
+        unsigned short * const indices = (unsigned short *)canvas->indices;
+        indices[index] = (unsigned short)start;
+        indices[index + 1U] = (unsigned short)end;
+    }
+
+    else
+    {
+        unsigned int * const indices = (unsigned int *)canvas->indices;
+        indices[index] = start;
+        indices[index + 1U] = end;
+    }
+}
+/*  End of store_line_segment.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_rectangular_row                                                 *
+ *  Purpose:                                                                  *
+ *      Writes the line segments of the square wireframe based at the points  *
+ *      of one row.                                                           *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose index buffer is being written to.                *
+ *      y_index (unsigned int):                                               *
+ *          The row, between zero and ny_pts - 1.                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each point is connected to the point above it and the point to its    *
+ *      right, if they exist. Rather than checking for the top and right edges*
+ *      at every point, the interior of the row, its last point, and the last *
+ *      row are handled by separate loops. The segments are written in the    *
+ *      same order either way, and every row but the last starts at y_index   *
+ *      times the size of a full row.                                         *
+ ******************************************************************************/
+static inline void
+store_rectangular_row(Canvas * const canvas, unsigned int y_index)
+{
+    /*  Every row but the last has nx_pts vertical segments and nx_pts - 1    *
+     *  horizontal segments, each with two indices.                           */
+    const unsigned int row_size = 2U * (2U * canvas->nx_pts - 1U);
+
+    /*  The indices are row-major, the first point of the row is at shift.    */
+    const unsigned int shift = y_index * canvas->nx_pts;
+    const unsigned int last = shift + canvas->nx_pts - 1U;
+
+    /*  Variables for the point being connected, and for the index buffer.    */
+    unsigned int point;
+    unsigned int index = y_index * row_size;
+
+    /*  The last row has no points above it, only the horizontal segments.    */
+    if (y_index == canvas->ny_pts - 1U)
+    {
+        for (point = shift; point < last; ++point)
+        {
+            store_line_segment(canvas, index, point, point + 1U);
+            index += 2U;
+        }
+
+        return;
+    }
+
+    /*  Interior points get an "L" shape, up and to the right.                */
+    for (point = shift; point < last; ++point)
+    {
+        store_line_segment(canvas, index, point, point + canvas->nx_pts);
+        store_line_segment(canvas, index + 2U, point, point + 1U);
+        index += 4U;
+    }
+
+    /*  The last point of the row has nothing to its right.                   */
+    store_line_segment(canvas, index, last, last + canvas->nx_pts);
+}
+/*  End of store_rectangular_row.                                             */
+
+#endif
+/*  End of include guard.                                                     */
@@ -26,7 +26,7 @@
 /*  Canvas and CanvasParameters typedefs provided here.                       */
 #include <threetools/types.h>
 
-/*  The main_canvas and buffer globals are declared here.                     */
+/*  The main_canvas global is declared here.                                  */
 #include <threetools/globals.h>
 
 /*  Function prototype / forward declaration found here.                      */
@@ -45,17 +45,8 @@
  ******************************************************************************/
 void init_main_canvas(const CanvasParameters * const parameters)
 {
-    /*  Most of the JavaScript / Godot parameters are the same, copy them.    */
-    main_canvas.nx_pts = parameters->nx_pts;
-    main_canvas.ny_pts = parameters->ny_pts;
-    main_canvas.width = parameters->width;
-    main_canvas.height = parameters->height;
-    main_canvas.horizontal_start = parameters->x_start;
-    main_canvas.vertical_start = parameters->y_start;
-    main_canvas.mesh_type = parameters->mesh_type;
-
-    /*  The remaining variables in the canvas can be computed from these.     */
-    reset_mesh_buffer(&main_canvas, mesh_buffer);
-    reset_index_buffer(&main_canvas, index_buffer);
+    /*  The main canvas is a global, and hence zero-initialized. The first    *
+     *  call allocates its buffers, later calls reuse or grow them.           */
+    allocate_canvas(&main_canvas, parameters);
 }
 /*  End of init_main_canvas.                                                  */
@@ -0,0 +1,54 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Marks the wireframe stored in a canvas as out of date.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and IndexTopology typedefs found here.                             */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      invalidate_index_topology                                             *
+ *  Purpose:                                                                  *
+ *      Forgets the topology the index buffer was generated for.              *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose index buffer no longer holds a valid wireframe.  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The topology is reset to an empty grid. Empty grids have no indices,  *
+ *      so matching one is harmless and the next call to                      *
+ *      generate_cached_wireframe with a non-empty grid regenerates the       *
+ *      indices.                                                              *
+ ******************************************************************************/
+void invalidate_index_topology(Canvas * const canvas)
+{
+    canvas->index_topology.nx_pts = 0U;
+    canvas->index_topology.ny_pts = 0U;
+    canvas->index_topology.mesh_type = SquareWireframe;
+}
+/*  End of invalidate_index_topology.                                         */
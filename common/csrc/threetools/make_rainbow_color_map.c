@@ -0,0 +1,167 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Fills a color map with a rainbow, from red at the bottom to blue at   *
+ *      the top.                                                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  powf found here.                                                          */
+#include <math.h>
+
+/*  ColorMap typedef and COLOR_MAP_SIZE provided here.                        */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  The red and blue channels are offset from the hue by a third of a turn.   */
+#define ONE_THIRD (3.333333333333333E-01F)
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      hue_to_channel                                                        *
+ *  Purpose:                                                                  *
+ *      Computes one channel of an HSL color with full saturation and a       *
+ *      lightness of one half.                                                *
+ *  Arguments:                                                                *
+ *      hue (float):                                                          *
+ *          The hue, shifted by a third of a turn for the red and blue        *
+ *          channels.                                                         *
+ *  Output:                                                                   *
+ *      channel (float):                                                      *
+ *          The value of the channel, between 0 and 1.                        *
+ *  Notes:                                                                    *
+ *      This is the hue to RGB step of the HSL conversion used by three.js,   *
+ *      Color.setHSL, simplified for these values of the saturation and       *
+ *      lightness.                                                            *
+ ******************************************************************************/
+static float hue_to_channel(float hue)
+{
+    /*  Wrap the hue into [0, 1).                                             */
+    if (hue < 0.0F)
+        hue += 1.0F;
+
+    else if (hue >= 1.0F)
+        hue -= 1.0F;
+
+    if (hue < 1.0F / 6.0F)
+        return 6.0F * hue;
+
+    if (hue < 0.5F)
+        return 1.0F;
+
+    if (hue < 2.0F / 3.0F)
+        return 6.0F * (2.0F / 3.0F - hue);
+
+    return 0.0F;
+}
+/*  End of hue_to_channel.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      srgb_to_byte                                                          *
+ *  Purpose:                                                                  *
+ *      Converts an sRGB channel to a linear byte.                            *
+ *  Arguments:                                                                *
+ *      channel (float):                                                      *
+ *          The sRGB value of the channel, between 0 and 1.                   *
+ *  Output:                                                                   *
+ *      byte (unsigned char):                                                 *
+ *          The linear value of the channel, scaled to [0, 255].              *
+ *  Notes:                                                                    *
+ *      three.js converts colors set with setHSL from sRGB to its linear      *
+ *      working color space, vertex colors are expected to be linear.         *
+ ******************************************************************************/
+static unsigned char srgb_to_byte(float channel)
+{
+    float linear;
+
+    if (channel <= 0.04045F)
+        linear = channel / 12.92F;
+    else
+        linear = powf((channel + 0.055F) / 1.055F, 2.4F);
+
+    return (unsigned char)(255.0F * linear + 0.5F);
+}
+/*  End of srgb_to_byte.                                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      make_rainbow_color_map                                                *
+ *  Purpose:                                                                  *
+ *      Fills a color map with a rainbow, blue at the minimum value and red at*
+ *      the maximum.                                                          *
+ *  Arguments:                                                                *
+ *      map (ColorMap * const):                                               *
+ *          The color map being filled.                                       *
+ *      min_value (float):                                                    *
+ *          The value that is colored blue.                                   *
+ *      max_value (float):                                                    *
+ *          The value that is colored red.                                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is the color map from hyperbolicParaboloidRainbowColorMap, the   *
+ *      hue is 0.7 (1 - t) for t between 0 and 1, with full saturation and a  *
+ *      lightness of one half. If the range is empty, every value gets the    *
+ *      first entry.                                                          *
+ ******************************************************************************/
+void
+make_rainbow_color_map(ColorMap * const map, float min_value, float max_value)
+{
+    /*  Variable for indexing over the entries of the table.                  */
+    unsigned int index;
+
+    /*  Step in t between consecutive entries of the table.                   */
+    const float dt = 1.0F / (float)(COLOR_MAP_SIZE - 1U);
+
+    map->min_value = min_value;
+    map->max_value = max_value;
+
+    if (max_value > min_value)
+    {
+        const float range = max_value - min_value;
+        map->index_factor = (float)(COLOR_MAP_SIZE - 1U) / range;
+    }
+
+    else
+        map->index_factor = 0.0F;
+
+    for (index = 0U; index < COLOR_MAP_SIZE; ++index)
+    {
+        /*  The hue goes from blue, 0.7, at the bottom to red, 0, at the top. */
+        const float hue = 0.7F * (1.0F - (float)(index) * dt);
+
+        /*  The red and blue channels are a third of a turn to either side.   */
+        const float red = hue_to_channel(hue + ONE_THIRD);
+        const float green = hue_to_channel(hue);
+        const float blue = hue_to_channel(hue - ONE_THIRD);
+
+        map->table[3U * index] = srgb_to_byte(red);
+        map->table[3U * index + 1U] = srgb_to_byte(green);
+        map->table[3U * index + 2U] = srgb_to_byte(blue);
+    }
+}
+/*  End of make_rainbow_color_map.                                            */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef ONE_THIRD
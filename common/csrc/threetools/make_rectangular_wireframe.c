@@ -43,14 +43,15 @@
  *      surface (const SurfaceParametrization):                               *
  *          The parametrization, a function of the form z = f(x, y).          *
  *  Output:                                                                   *
- *      None (void).                                                          *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated, zero if only the    *
+ *          vertices were recomputed.                                         *
  ******************************************************************************/
-void
+unsigned int
 make_rectangular_wireframe(const CanvasParameters * const parameters,
                            const SurfaceParametrization surface)
 {
     init_main_canvas(parameters);
-    generate_parametric_mesh(&main_canvas, surface);
-    generate_rectangular_wireframe(&main_canvas);
+    return generate_canvas_wireframe(&main_canvas, surface);
 }
 /*  End of make_rectangular_wireframe.                                        */
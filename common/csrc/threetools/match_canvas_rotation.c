@@ -0,0 +1,93 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rotates a canvas to the same angle as another one.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and UnitVector typedefs found here.                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  cosf and sinf found here.                                                 */
+#include <math.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      match_canvas_rotation                                                 *
+ *  Purpose:                                                                  *
+ *      Rotates a canvas about the z axis so that its total angle matches the *
+ *      angle of a reference canvas.                                          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being rotated.                                         *
+ *      reference (const Canvas * const):                                     *
+ *          The canvas whose angle is copied.                                 *
+ *  Output:                                                                   *
+ *      rotated (unsigned int):                                               *
+ *          Non-zero if the canvas was rotated, and its output changed.       *
+ *  Notes:                                                                    *
+ *      This keeps canvases that are drawn in turn, like the levels of a      *
+ *      CanvasPyramid, in step when only the one being drawn is rotated with  *
+ *      z_rotate_canvas. Absolute rotations recompute the output from the     *
+ *      angle. Incremental rotations rotate the mesh in place by the          *
+ *      difference of the angles. Nothing is done if the angles are equal.    *
+ ******************************************************************************/
+unsigned int
+match_canvas_rotation(Canvas * const canvas, const Canvas * const reference)
+{
+    /*  The canvas is rotated by the difference of the two angles.            */
+    const float angle = reference->angle - canvas->angle;
+
+    /*  Canvases that are never rotated, like those using the GPU rotation,   *
+     *  are already in step.                                                  */
+    if (angle == 0.0F)
+        return 0U;
+
+    canvas->angle = reference->angle;
+
+    /*  Incremental rotations modify the mesh, and the normals, in place.     */
+    if (canvas->rotation_mode == IncrementalRotation)
+    {
+        UnitVector point;
+        point.cos_angle = cosf(angle);
+        point.sin_angle = sinf(angle);
+        rotate_mesh(canvas, point);
+
+        if (canvas->normals)
+            rotate_interleaved_buffer(
+                canvas->normals, canvas->number_of_points, point
+            );
+    }
+
+    /*  Bring the output buffer, which is what is rendered, up to date.       */
+    update_output_buffer(canvas);
+
+    /*  Absolute rotations recompute the normals from the output, the same as *
+     *  in z_rotate_canvas.                                                   */
+    if (canvas->rotation_mode == AbsoluteRotation && canvas->normals)
+        compute_canvas_normals(canvas);
+
+    return 1U;
+}
+/*  End of match_canvas_rotation.                                             */
@@ -0,0 +1,54 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the output buffer.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      output_buffer_address                                                 *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the interleaved output array.                    *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the output buffer that we want.             *
+ *  Output:                                                                   *
+ *      output (float *):                                                     *
+ *          A pointer to the output array.                                    *
+ *  Notes:                                                                    *
+ *      This function is called at the JavaScript level to get the address for*
+ *      the array that three.js renders from. For interleaved meshes this is  *
+ *      the same as mesh_buffer_address.                                      *
+ ******************************************************************************/
+float *output_buffer_address(const Canvas * const canvas)
+{
+    /*  At the JavaScript level this is used to get the address of the        *
+     *  interleaved vertices for rendering.                                   */
+    return canvas->output;
+}
+/*  End of output_buffer_address.                                             */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Packs a planar mesh into an interleaved buffer for rendering.         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and MeshLayout typedefs provided here.                             */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      pack_planar_mesh                                                      *
+ *  Purpose:                                                                  *
+ *      Copies the x, y, and z planes of a planar mesh into the interleaved   *
+ *      output buffer, which is the format three.js expects.                  *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the planar mesh and the output buffer.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Interleaved meshes are rendered directly, nothing is done for these.  *
+ ******************************************************************************/
+void pack_planar_mesh(Canvas * const canvas)
+{
+    /*  Variable for indexing over the points in the mesh.                    */
+    unsigned int index;
+
+    /*  Pointers to the three planes of the mesh. The x values are first,     *
+     *  followed by the y values, and then the z values.                      */
+    const float * const x = canvas->mesh;
+    const float * const y = x + canvas->number_of_points;
+    const float * const z = y + canvas->number_of_points;
+
+    /*  Interleaved meshes return before the timer is stopped, and so are     *
+     *  not counted.                                                          */
+    PROFILE_START;
+
+    /*  Interleaved meshes are already in the output buffer. Nothing to do.   */
+    if (canvas->layout != PlanarLayout)
+        return;
+
+    /*  Loop through the points and write them as (x, y, z) triples.          */
+    for (index = 0; index < canvas->number_of_points; ++index)
+    {
+        canvas->output[3U * index] = x[index];
+        canvas->output[3U * index + 1U] = y[index];
+        canvas->output[3U * index + 2U] = z[index];
+    }
+
+    PROFILE_STOP(PackPlanarKernel, canvas->number_of_points);
+}
+/*  End of pack_planar_mesh.                                                  */
@@ -0,0 +1,190 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Splits the rows of a canvas across several threads.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and RowKernel typedefs found here.                                 */
+#include <threetools/types.h>
+
+/*  The thread_count global and MAX_THREAD_COUNT macro are declared here.     */
+#include <threetools/globals.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  Threads are only available in the -pthread build of the library.          */
+#if defined(THREETOOLS_USE_PTHREADS)
+#include <pthread.h>
+#endif
+
+/*  Starting a thread is not free. Small meshes, which are generated in well  *
+ *  under a millisecond, are not split. Each thread gets at least this many   *
+ *  points.                                                                   */
+#define MIN_POINTS_PER_THREAD (16384U)
+
+#if defined(THREETOOLS_USE_PTHREADS)
+
+/*  A band of rows that is processed by a single thread.                      */
+typedef struct RowBand {
+    Canvas *canvas;
+    RowKernel kernel;
+    const void *data;
+    unsigned int first_row, end_row;
+} RowBand;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      row_band_worker                                                       *
+ *  Purpose:                                                                  *
+ *      Entry point for the threads, processes one band of rows.              *
+ *  Arguments:                                                                *
+ *      arg (void *):                                                         *
+ *          Pointer to the RowBand for the thread.                            *
+ *  Output:                                                                   *
+ *      result (void *):                                                      *
+ *          Always NULL.                                                      *
+ ******************************************************************************/
+static void *row_band_worker(void *arg)
+{
+    const RowBand * const band = arg;
+    band->kernel(band->canvas, band->data, band->first_row, band->end_row);
+    return NULL;
+}
+/*  End of row_band_worker.                                                   */
+
+#endif
+/*  End of #if defined(THREETOOLS_USE_PTHREADS).                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parallel_rows                                                         *
+ *  Purpose:                                                                  *
+ *      Runs a row kernel over a range of rows of a canvas, splitting the     *
+ *      rows into bands that are processed in parallel.                       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being processed.                                       *
+ *      kernel (RowKernel):                                                   *
+ *          The kernel for a band of rows.                                    *
+ *      data (const void * const):                                            *
+ *          Extra data passed to the kernel.                                  *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The calling thread processes the first band itself, and returns once  *
+ *      every band is done. Threads are created per call, in the browser these*
+ *      come from the emscripten worker pool and are cheap to start. If a     *
+ *      thread can not be created, its band is processed on the calling       *
+ *      thread. Builds without THREETOOLS_USE_PTHREADS run the kernel over    *
+ *      the whole range directly.                                             *
+ ******************************************************************************/
+void
+parallel_rows(Canvas * const canvas,
+              RowKernel kernel,
+              const void * const data,
+              unsigned int first_row,
+              unsigned int end_row)
+{
+#if defined(THREETOOLS_USE_PTHREADS)
+
+    /*  The number of rows being processed.                                   */
+    const unsigned int rows = (end_row > first_row ? end_row - first_row : 0U);
+
+    /*  Do not use more threads than the rows can keep busy.                  */
+    const unsigned int most_threads =
+        rows * canvas->nx_pts / MIN_POINTS_PER_THREAD;
+
+    unsigned int threads = thread_count;
+
+    /*  The bands of rows, and the threads processing them.                   */
+    RowBand bands[MAX_THREAD_COUNT];
+    pthread_t ids[MAX_THREAD_COUNT];
+    int started[MAX_THREAD_COUNT];
+
+    /*  Variables for indexing over the bands, and the size of the bands.     */
+    unsigned int n, rows_per_band, extra_rows, row;
+
+    if (threads > most_threads)
+        threads = most_threads;
+
+    if (threads > rows)
+        threads = rows;
+
+    /*  Nothing to split, process every row on this thread.                   */
+    if (threads <= 1U)
+    {
+        if (rows != 0U)
+            kernel(canvas, data, first_row, end_row);
+
+        return;
+    }
+
+    /*  Split the rows as evenly as possible. The first few bands get one     *
+     *  extra row if the rows do not divide evenly.                           */
+    rows_per_band = rows / threads;
+    extra_rows = rows % threads;
+    row = first_row;
+
+    for (n = 0U; n < threads; ++n)
+    {
+        bands[n].canvas = canvas;
+        bands[n].kernel = kernel;
+        bands[n].data = data;
+        bands[n].first_row = row;
+        row += rows_per_band + (n < extra_rows ? 1U : 0U);
+        bands[n].end_row = row;
+    }
+
+    /*  Start a thread for every band but the first, which is processed here. */
+    for (n = 1U; n < threads; ++n)
+        started[n] =
+            pthread_create(&ids[n], NULL, row_band_worker, &bands[n]) == 0;
+
+    row_band_worker(&bands[0]);
+
+    /*  Wait for the other bands. Any band whose thread failed to start is    *
+     *  processed now.                                                        */
+    for (n = 1U; n < threads; ++n)
+    {
+        if (started[n])
+            pthread_join(ids[n], NULL);
+        else
+            row_band_worker(&bands[n]);
+    }
+
+#else
+
+    /*  Single threaded build, process every row on this thread.              */
+    if (end_row > first_row)
+        kernel(canvas, data, first_row, end_row);
+
+#endif
+}
+/*  End of parallel_rows.                                                     */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef MIN_POINTS_PER_THREAD
@@ -0,0 +1,393 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Runs the row kernels for a surface z = f(x, y) over a whole canvas,   *
+ *      an update, or a band. Shared by the C functions and the templates in  *
+ *      threetools.hpp, which only differ in the kernels they pass.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_PARAMETRIC_H
+#define THREETOOLS_PARAMETRIC_H
+
+/*  Canvas, CanvasUpdate, CanvasBand, and RowKernel typedefs provided here.   */
+#include <threetools/types.h>
+
+/*  parallel_rows, plan_canvas_update, and the other C functions found here.  */
+#include <threetools/threetools.h>
+
+/*  The loops the kernels are made of, and HeightEvaluator, provided here.    */
+#include <threetools/rows.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernels, provided here.    */
+#include <threetools/profile.h>
+
+/*  The row kernels for one surface. The data pointer given to parallel_rows  *
+ *  is passed to each of them unchanged.                                      */
+typedef struct ParametricKernels {
+
+    /*  The vertices, and the vertices with their colors.                     */
+    RowKernel plain, colored;
+
+    /*  The vertices, colored or not, and the line segments of each row.      */
+    RowKernel fused;
+} ParametricKernels;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_parametrization                                              *
+ *  Purpose:                                                                  *
+ *      Evaluates a SurfaceParametrization passed by address.                 *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the SurfaceParametrization defining the surface.       *
+ *      x (float):                                                            *
+ *          The x coordinate of the point.                                    *
+ *      y (float):                                                            *
+ *          The y coordinate of the point.                                    *
+ *  Output:                                                                   *
+ *      z (float):                                                            *
+ *          The height of the surface at (x, y).                              *
+ *  Notes:                                                                    *
+ *      Function pointers can not be stored in a void pointer, so the C       *
+ *      functions pass the address of theirs.                                 *
+ ******************************************************************************/
+static inline float
+evaluate_parametrization(const void * const data, float x, float y)
+{
+    const SurfaceParametrization f = *(const SurfaceParametrization *)data;
+    return f(x, y);
+}
+/*  End of evaluate_parametrization.                                          */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parametrization_rows                                                  *
+ *  Purpose:                                                                  *
+ *      Row kernel for a SurfaceParametrization, computes the vertices in a   *
+ *      band of rows.                                                         *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the SurfaceParametrization defining the surface.       *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static inline void
+parametrization_rows(Canvas * const canvas,
+                     const void * const data,
+                     unsigned int first_row,
+                     unsigned int end_row)
+{
+    store_parametric_rows(
+        canvas, evaluate_parametrization, data, first_row, end_row, NULL
+    );
+}
+/*  End of parametrization_rows.                                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      colored_parametrization_rows                                          *
+ *  Purpose:                                                                  *
+ *      Row kernel for a SurfaceParametrization, computes the vertices and    *
+ *      colors in a band of rows.                                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the SurfaceParametrization defining the surface.       *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static inline void
+colored_parametrization_rows(Canvas * const canvas,
+                             const void * const data,
+                             unsigned int first_row,
+                             unsigned int end_row)
+{
+    store_parametric_rows(
+        canvas, evaluate_parametrization, data, first_row, end_row,
+        parametric_colors(canvas, first_row)
+    );
+}
+/*  End of colored_parametrization_rows.                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      fused_parametrization_rows                                            *
+ *  Purpose:                                                                  *
+ *      Row kernel for a SurfaceParametrization, computes the vertices and    *
+ *      line segments in a band of rows.                                      *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the SurfaceParametrization defining the surface.       *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static inline void
+fused_parametrization_rows(Canvas * const canvas,
+                           const void * const data,
+                           unsigned int first_row,
+                           unsigned int end_row)
+{
+    store_fused_rows(
+        canvas, evaluate_parametrization, data, first_row, end_row
+    );
+}
+/*  End of fused_parametrization_rows.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parametrization_kernels                                               *
+ *  Purpose:                                                                  *
+ *      Gives the row kernels for a SurfaceParametrization.                   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      kernels (ParametricKernels):                                          *
+ *          The kernels, each expecting a pointer to the function pointer.    *
+ ******************************************************************************/
+static inline ParametricKernels parametrization_kernels(void)
+{
+    ParametricKernels kernels;
+    kernels.plain = parametrization_rows;
+    kernels.colored = colored_parametrization_rows;
+    kernels.fused = fused_parametrization_rows;
+    return kernels;
+}
+/*  End of parametrization_kernels.                                           */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_parametric_rows                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a range of rows of a mesh z = f(x, y).       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      kernels (const ParametricKernels * const):                            *
+ *          The row kernels for the surface.                                  *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to the kernels.                            *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is computed.                                   *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is computed.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases with a color map are colored in the same pass.               *
+ ******************************************************************************/
+static inline void
+run_parametric_rows(Canvas * const canvas,
+                    const ParametricKernels * const kernels,
+                    const void * const data,
+                    unsigned int first_row,
+                    unsigned int end_row)
+{
+    const RowKernel kernel =
+        (canvas->colors && canvas->color_map ? kernels->colored
+                                             : kernels->plain);
+    PROFILE_START;
+
+    parallel_rows(canvas, kernel, data, first_row, end_row);
+
+    /*  Only the rows in the range are counted, for incremental updates.      */
+    PROFILE_STOP(ParametricMeshKernel, (end_row - first_row) * canvas->nx_pts);
+}
+/*  End of run_parametric_rows.                                               */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_canvas_wireframe                                                  *
+ *  Purpose:                                                                  *
+ *      Creates a wireframe, of the canvas's mesh type, for a surface of the  *
+ *      form z = f(x, y).                                                     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      kernels (const ParametricKernels * const):                            *
+ *          The row kernels for the surface.                                  *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to the kernels.                            *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ ******************************************************************************/
+static inline unsigned int
+run_canvas_wireframe(Canvas * const canvas,
+                     const ParametricKernels * const kernels,
+                     const void * const data)
+{
+    run_parametric_rows(canvas, kernels, data, 0U, canvas->ny_pts);
+    update_output_buffer(canvas);
+    compute_canvas_normals(canvas);
+    return generate_cached_wireframe(canvas);
+}
+/*  End of run_canvas_wireframe.                                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_fused_wireframe                                                   *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe for a surface of the form z = f(x, y),     *
+ *      computing the vertices and line segments of each row together.        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      kernels (const ParametricKernels * const):                            *
+ *          The row kernels for the surface.                                  *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to the kernels.                            *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ *  Notes:                                                                    *
+ *      Only square wireframes are fused. Other mesh types, and index buffers *
+ *      that are already up to date, use run_canvas_wireframe.                *
+ ******************************************************************************/
+static inline unsigned int
+run_fused_wireframe(Canvas * const canvas,
+                    const ParametricKernels * const kernels,
+                    const void * const data)
+{
+    /*  The topology the index buffer was last generated for.                 */
+    IndexTopology * const cached = &canvas->index_topology;
+
+    /*  Reused indices only need the vertex pass.                             */
+    const unsigned int fused =
+        canvas->mesh_type == SquareWireframe &&
+        (cached->nx_pts != canvas->nx_pts ||
+         cached->ny_pts != canvas->ny_pts ||
+         cached->mesh_type != canvas->mesh_type);
+
+    if (fused)
+    {
+        PROFILE_START;
+        parallel_rows(canvas, kernels->fused, data, 0U, canvas->ny_pts);
+        PROFILE_STOP(FusedWireframeKernel, canvas->number_of_points);
+
+        cached->nx_pts = canvas->nx_pts;
+        cached->ny_pts = canvas->ny_pts;
+        cached->mesh_type = canvas->mesh_type;
+
+        update_output_buffer(canvas);
+        compute_canvas_normals(canvas);
+        return 1U;
+    }
+
+    return run_canvas_wireframe(canvas, kernels, data);
+}
+/*  End of run_fused_wireframe.                                               */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_canvas_update                                                     *
+ *  Purpose:                                                                  *
+ *      Updates a canvas for new parameters, recomputing only what changed.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *      kernels (const ParametricKernels * const):                            *
+ *          The row kernels for the surface.                                  *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to the kernels.                            *
+ *  Output:                                                                   *
+ *      update (CanvasUpdate):                                                *
+ *          The dirty ranges of the output and index buffers.                 *
+ ******************************************************************************/
+static inline CanvasUpdate
+run_canvas_update(Canvas * const canvas,
+                  const CanvasParameters * const parameters,
+                  const ParametricKernels * const kernels,
+                  const void * const data)
+{
+    /*  Resize the canvas and find the rows that need to be computed.         */
+    CanvasUpdate update = plan_canvas_update(canvas, parameters);
+
+    /*  Only the new or changed rows are computed, the rest are left as is.   */
+    run_parametric_rows(
+        canvas, kernels, data, update.first_row, canvas->ny_pts
+    );
+
+    finish_canvas_update(canvas, &update);
+    return update;
+}
+/*  End of run_canvas_update.                                                 */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      run_canvas_band                                                       *
+ *  Purpose:                                                                  *
+ *      Computes the next few rows of a mesh for a surface of the form z =    *
+ *      f(x, y).                                                              *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being generated.                                       *
+ *      kernels (const ParametricKernels * const):                            *
+ *          The row kernels for the surface.                                  *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to the kernels.                            *
+ *      first_row (unsigned int):                                             *
+ *          The first row of the band, zero for the first band.               *
+ *      rows (unsigned int):                                                  *
+ *          The height of the band, in rows.                                  *
+ *  Output:                                                                   *
+ *      band (CanvasBand):                                                    *
+ *          The rows that were computed and the ranges of the output and index*
+ *          buffers that changed or became drawable.                          *
+ ******************************************************************************/
+static inline CanvasBand
+run_canvas_band(Canvas * const canvas,
+                const ParametricKernels * const kernels,
+                const void * const data,
+                unsigned int first_row,
+                unsigned int rows)
+{
+    /*  Clamp the band to the grid and find its ranges.                       */
+    const CanvasBand band = plan_canvas_band(canvas, first_row, rows);
+
+    run_parametric_rows(canvas, kernels, data, band.first_row, band.end_row);
+    finish_canvas_band(canvas, &band);
+    return band;
+}
+/*  End of run_canvas_band.                                                   */
+
+#endif
+/*  End of include guard.                                                     */
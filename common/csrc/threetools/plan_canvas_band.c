@@ -0,0 +1,168 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Finds the rows and buffer ranges for a band of a progressively        *
+ *      generated mesh.                                                       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, CanvasBand, and MeshType typedefs found here.                     */
+#include <threetools/types.h>
+
+/*  horizontal_gluing, used for counting the segments in a row, found here.   */
+#include <threetools/gluing.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      row_index_size                                                        *
+ *  Purpose:                                                                  *
+ *      Computes the number of indices for the line segments based at the     *
+ *      points of a row, for every row but the last.                          *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas the row lies in.                                       *
+ *  Output:                                                                   *
+ *      size (unsigned int):                                                  *
+ *          The number of indices, two per line segment.                      *
+ *  Notes:                                                                    *
+ *      This is the row_size used by the band kernels of the wireframe        *
+ *      generators.                                                           *
+ ******************************************************************************/
+static unsigned int row_index_size(const Canvas * const canvas)
+{
+    /*  Rows have nx_pts horizontal segments if the left and right edges are  *
+     *  glued, and nx_pts - 1 otherwise.                                      */
+    const EdgeGluing horizontal = horizontal_gluing(canvas->mesh_type);
+    const unsigned int horizontal_segments =
+        (horizontal == NoGluing ? canvas->nx_pts - 1U : canvas->nx_pts);
+
+    /*  Every point has a vertical segment, triangle wireframes also have a   *
+     *  diagonal for each horizontal segment.                                 */
+    switch (canvas->mesh_type)
+    {
+        case TriangleWireframe:
+        case CylindricalTriangleWireframe:
+        case MobiusTriangleWireframe:
+        case TorodialTriangleWireframe:
+        case KleinTriangleWireframe:
+        case ProjectiveTriangleWireframe:
+            return 2U * (canvas->nx_pts + 2U * horizontal_segments);
+
+        default:
+            return 2U * (canvas->nx_pts + horizontal_segments);
+    }
+}
+/*  End of row_index_size.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      drawable_indices                                                      *
+ *  Purpose:                                                                  *
+ *      Counts the indices that may be drawn once the first rows of the mesh  *
+ *      have been computed.                                                   *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas being generated.                                       *
+ *      rows (unsigned int):                                                  *
+ *          The number of rows, from the start of the mesh, that have been    *
+ *          computed.                                                         *
+ *  Output:                                                                   *
+ *      count (unsigned int):                                                 *
+ *          The number of indices at the start of the index buffer whose      *
+ *          vertices have all been computed.                                  *
+ *  Notes:                                                                    *
+ *      The segments based at a row reach up to the next row, and for glued   *
+ *      grids the last row reaches back to the first. Only the last band,     *
+ *      which completes the mesh, makes every segment drawable. Mobius strips,*
+ *      Klein bottles, and projective planes are only drawn once complete.    *
+ ******************************************************************************/
+static unsigned int
+drawable_indices(const Canvas * const canvas, unsigned int rows)
+{
+    if (rows >= canvas->ny_pts)
+        return canvas->index_size;
+
+    /*  Twisted left and right edges connect row y to row ny_pts - 1 - y, in  *
+     *  the other half of the grid. Nothing is drawn until the mesh is done.  */
+    if (rows < 2U || horizontal_gluing(canvas->mesh_type) == TwistedGluing)
+        return 0U;
+
+    return (rows - 1U) * row_index_size(canvas);
+}
+/*  End of drawable_indices.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      plan_canvas_band                                                      *
+ *  Purpose:                                                                  *
+ *      Finds the rows, and the ranges of the output and index buffers, for   *
+ *      the next band of a mesh that is generated a few rows at a time.       *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas being generated.                                       *
+ *      first_row (unsigned int):                                             *
+ *          The first row of the band, zero for the first band.               *
+ *      rows (unsigned int):                                                  *
+ *          The height of the band, in rows.                                  *
+ *  Output:                                                                   *
+ *      band (CanvasBand):                                                    *
+ *          The rows of the band, clamped to the grid, and its ranges.        *
+ *  Notes:                                                                    *
+ *      A band starting past the last row is empty and done.                  *
+ ******************************************************************************/
+CanvasBand
+plan_canvas_band(const Canvas * const canvas,
+                 unsigned int first_row,
+                 unsigned int rows)
+{
+    CanvasBand band;
+
+    /*  Clamp the band to the grid. A zero height would never finish.         */
+    if (rows == 0U)
+        rows = 1U;
+
+    if (first_row > canvas->ny_pts)
+        first_row = canvas->ny_pts;
+
+    band.first_row = first_row;
+
+    if (rows > canvas->ny_pts - first_row)
+        band.end_row = canvas->ny_pts;
+    else
+        band.end_row = first_row + rows;
+
+    band.done = (band.end_row == canvas->ny_pts ? 1U : 0U);
+
+    /*  The output buffer is interleaved, three floats per point.             */
+    band.output_start = 3U * band.first_row * canvas->nx_pts;
+    band.output_count = 3U * (band.end_row - band.first_row) * canvas->nx_pts;
+
+    /*  The segments that were waiting on the rows of this band.              */
+    band.index_start = drawable_indices(canvas, band.first_row);
+    band.index_count =
+        drawable_indices(canvas, band.end_row) - band.index_start;
+
+    return band;
+}
+/*  End of plan_canvas_band.                                                  */
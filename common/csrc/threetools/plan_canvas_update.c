@@ -0,0 +1,221 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Prepares a canvas for an incremental update.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, CanvasParameters, and CanvasUpdate typedefs found here.           */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rows_to_keep                                                          *
+ *  Purpose:                                                                  *
+ *      Counts the rows of the current mesh that are the same for the new     *
+ *      parameters.                                                           *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas before the update.                                     *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *  Output:                                                                   *
+ *      rows (unsigned int):                                                  *
+ *          The number of rows at the start of the mesh that are unchanged.   *
+ ******************************************************************************/
+static unsigned int
+rows_to_keep(const Canvas * const canvas,
+             const CanvasParameters * const parameters)
+{
+    /*  Vertical step sizes before and after the update.                      */
+    float old_dy, new_dy;
+
+    /*  The step size is height / (ny_pts - 1). Empty or degenerate canvases  *
+     *  have nothing worth keeping.                                           */
+    if (canvas->ny_pts < 2U || parameters->ny_pts < 2U)
+        return 0U;
+
+    /*  The shape and contents of every row depends on these. The mesh type   *
+     *  sets the gluing, which changes the step size and the normals, see     *
+     *  gluing.h.                                                             */
+    if (canvas->nx_pts != parameters->nx_pts ||
+        canvas->mesh_type != parameters->mesh_type ||
+        canvas->layout != parameters->layout ||
+        canvas->rotation_mode != parameters->rotation_mode)
+        return 0U;
+
+    if (canvas->width != parameters->width ||
+        canvas->horizontal_start != parameters->x_start ||
+        canvas->vertical_start != parameters->y_start)
+        return 0U;
+
+    /*  Incremental rotations write to the mesh. Once it has been rotated the *
+     *  rows no longer match the surface, and new rows would not match them.  */
+    if (canvas->rotation_mode == IncrementalRotation && canvas->angle != 0.0F)
+        return 0U;
+
+    /*  Likewise for transform_mesh, which writes to the mesh for any mode.   */
+    if (canvas->mesh_transformed)
+        return 0U;
+
+    /*  Same grid, the only thing that can differ is the height.              */
+    if (canvas->ny_pts == parameters->ny_pts)
+        return (canvas->height == parameters->height ? canvas->ny_pts : 0U);
+
+    /*  The y and z planes start after number_of_points floats, which changes *
+     *  with the number of rows. Every point of a planar mesh moves.          */
+    if (canvas->layout == PlanarLayout)
+        return 0U;
+
+    /*  The existing rows are kept if the rows are spaced the same. This is   *
+     *  the case when rows are added or removed along with the height.        */
+    old_dy = canvas->height / (float)(canvas->ny_pts - 1U);
+    new_dy = parameters->height / (float)(parameters->ny_pts - 1U);
+
+    if (old_dy != new_dy)
+        return 0U;
+
+    if (canvas->ny_pts < parameters->ny_pts)
+        return canvas->ny_pts;
+
+    return parameters->ny_pts;
+}
+/*  End of rows_to_keep.                                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      plan_canvas_update                                                    *
+ *  Purpose:                                                                  *
+ *      Resizes a canvas for new parameters, finding the rows of the mesh that*
+ *      are still valid.                                                      *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *  Output:                                                                   *
+ *      update (CanvasUpdate):                                                *
+ *          The rows that must be recomputed, starting at update.first_row,   *
+ *          and the dirty range of the output buffer.                         *
+ *  Notes:                                                                    *
+ *      Rows are kept if the mesh type, the grid spacing, the horizontal      *
+ *      domain, and the start of the vertical domain are unchanged, and the   *
+ *      buffers did not move. If the number of rows grows with the same       *
+ *      spacing, only the new rows need to be computed. Planar meshes keep    *
+ *      nothing if the number of rows changes, since the planes shift.        *
+ *      Incremental rotations modify the mesh itself, so nothing is kept once *
+ *      the mesh has been rotated, nor once it has been transformed with      *
+ *      transform_mesh. The mesh is computed by the caller, using             *
+ *      update.first_row, and finished with finish_canvas_update. If rows are *
+ *      removed, or the mesh type changed, normals_changed is set even if no  *
+ *      row needs to be computed. A buffer that was freed and allocated again *
+ *      may come back at the same address, so a buffer counts as moved if its *
+ *      capacity changed too. views_changed is only set if a buffer moved or  *
+ *      the index type changed. Buffers never shrink, so views created for a  *
+ *      grid with at least as many rows stay valid.                           *
+ ******************************************************************************/
+CanvasUpdate
+plan_canvas_update(Canvas * const canvas,
+                   const CanvasParameters * const parameters)
+{
+    CanvasUpdate update;
+
+    /*  Whether or not each buffer moved when the canvas was resized.         */
+    int mesh_moved, output_moved, normals_moved, colors_moved, indices_moved;
+
+    /*  The state of the canvas before it is resized, to see what changed.    */
+    const float * const mesh = canvas->mesh;
+    const float * const output = canvas->output;
+    const float * const normals = canvas->normals;
+    const unsigned char * const colors = canvas->colors;
+    const void * const indices = canvas->indices;
+    const unsigned int mesh_capacity = canvas->mesh_capacity;
+    const unsigned int output_capacity = canvas->output_capacity;
+    const unsigned int normals_capacity = canvas->normals_capacity;
+    const unsigned int colors_capacity = canvas->colors_capacity;
+    const unsigned int index_capacity = canvas->index_capacity;
+    const IndexType index_type = canvas->index_type;
+    const unsigned int ny_pts = canvas->ny_pts;
+    const MeshType mesh_type = canvas->mesh_type;
+    const RotationMode rotation_mode = canvas->rotation_mode;
+    const float angle = canvas->angle;
+    unsigned int kept = rows_to_keep(canvas, parameters);
+
+    /*  Buffers with enough capacity are reused, so this is cheap if the size *
+     *  of the grid did not grow.                                             */
+    allocate_canvas(canvas, parameters);
+
+    /*  Whether or not each buffer moved. Only the addresses are compared for *
+     *  buffers that are not owned, these have zero capacity.                 */
+    mesh_moved =
+        canvas->mesh != mesh || canvas->mesh_capacity != mesh_capacity;
+
+    output_moved =
+        canvas->output != output || canvas->output_capacity != output_capacity;
+
+    normals_moved =
+        canvas->normals != normals ||
+        canvas->normals_capacity != normals_capacity;
+
+    colors_moved =
+        canvas->colors != colors || canvas->colors_capacity != colors_capacity;
+
+    indices_moved =
+        canvas->indices != indices || canvas->index_capacity != index_capacity;
+
+    /*  If a buffer moved, its contents are gone and every row is recomputed. */
+    if (mesh_moved || output_moved || colors_moved)
+        kept = 0U;
+
+    /*  allocate_canvas resets the angle. Absolute rotations compute the      *
+     *  output from the angle and not from the mesh, so the animation can     *
+     *  carry on where it was.                                                */
+    if (rotation_mode == AbsoluteRotation &&
+        canvas->rotation_mode == AbsoluteRotation)
+        canvas->angle = angle;
+
+    update.first_row = kept;
+    update.output_start = 3U * kept * canvas->nx_pts;
+    update.output_count = 3U * (canvas->ny_pts - kept) * canvas->nx_pts;
+
+    /*  The index buffer is checked by finish_canvas_update.                  */
+    update.index_start = 0U;
+    update.index_count = 0U;
+
+    /*  Removing rows computes nothing, but the new last row loses the row    *
+     *  above it. The gluing of the mesh type decides which points are        *
+     *  neighbors. Either way the normals are recomputed by                   *
+     *  finish_canvas_update.                                                 */
+    update.normals_changed =
+        canvas->ny_pts < ny_pts || canvas->mesh_type != mesh_type;
+
+    /*  JavaScript views have a fixed address and element type. Their length  *
+     *  may be larger than the mesh, see updateWireframeGeometry.js.          */
+    update.views_changed =
+        output_moved || normals_moved || colors_moved || indices_moved ||
+        canvas->index_type != index_type;
+
+    return update;
+}
+/*  End of plan_canvas_update.                                                */
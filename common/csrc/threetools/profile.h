@@ -0,0 +1,120 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides macros for timing the kernels in profiling builds of the     *
+ *      library.                                                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_PROFILE_H
+#define THREETOOLS_PROFILE_H
+
+/*  The kernel_counters global is declared here.                              */
+#include <threetools/globals.h>
+
+/*  Builds without THREETOOLS_PROFILE compile the macros to nothing, there is *
+ *  no cost to leaving them in the kernels.                                   */
+#ifdef THREETOOLS_PROFILE
+
+/*  The browser clock is provided by emscripten. Native builds, used for      *
+ *  benchmarks, have the monotonic clock instead.                             */
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#else
+#include <time.h>
+#endif
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      profile_now                                                           *
+ *  Purpose:                                                                  *
+ *      Returns the current time, in milliseconds, from a monotonic clock.    *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      now (double):                                                         *
+ *          The time, measured from an unspecified starting point.            *
+ *  Notes:                                                                    *
+ *      emscripten_get_now uses performance.now, which browsers may round to  *
+ *      limit timing attacks. The totals over many calls are still accurate.  *
+ ******************************************************************************/
+static inline double profile_now(void)
+{
+#ifdef __EMSCRIPTEN__
+    return emscripten_get_now();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return 1.0E3 * (double)now.tv_sec + 1.0E-6 * (double)now.tv_nsec;
+#endif
+}
+/*  End of profile_now.                                                       */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      record_kernel_call                                                    *
+ *  Purpose:                                                                  *
+ *      Adds one call of a kernel to its counters.                            *
+ *  Arguments:                                                                *
+ *      kernel (ProfileKernel):                                               *
+ *          The kernel that was timed.                                        *
+ *      points (unsigned int):                                                *
+ *          The number of points it processed.                                *
+ *      start (double):                                                       *
+ *          The time the call started, from profile_now.                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The counters are not atomic. In the threaded build the kernels are    *
+ *      timed on the thread that calls into the library, not on the workers,  *
+ *      so this is only a problem if two threads call into it at once.        *
+ ******************************************************************************/
+static inline void
+record_kernel_call(ProfileKernel kernel, unsigned int points, double start)
+{
+    KernelCounter * const counter = &kernel_counters[kernel];
+    counter->calls += 1.0;
+    counter->points += (double)points;
+    counter->nanoseconds += 1.0E6 * (profile_now() - start);
+}
+/*  End of record_kernel_call.                                                */
+
+/*  Starts the timer for a kernel. This declares a variable, so it must be    *
+ *  used where a declaration is allowed, at most once per scope.              */
+#define PROFILE_START const double profile_start = profile_now()
+
+/*  Stops the timer and adds the call to the counters of the kernel.          */
+#define PROFILE_STOP(kernel, points) \
+    record_kernel_call((kernel), (points), profile_start)
+
+#else
+
+/*  Without THREETOOLS_PROFILE nothing is timed. The point count is still     *
+ *  evaluated, and discarded, so variables used only for it are not unused.   */
+#define PROFILE_START do {} while (0)
+#define PROFILE_STOP(kernel, points) (void)(points)
+
+#endif
+/*  End of #ifdef THREETOOLS_PROFILE.                                         */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Tells whether the library was built with the kernel timers.           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      profiling_enabled                                                     *
+ *  Purpose:                                                                  *
+ *      Checks if the library was built with THREETOOLS_PROFILE.              *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      enabled (unsigned int):                                               *
+ *          One if the kernels are timed, zero otherwise.                     *
+ *  Notes:                                                                    *
+ *      This lets JavaScript tell counters that are zero because nothing ran  *
+ *      apart from counters that are zero because nothing is timed.           *
+ ******************************************************************************/
+unsigned int profiling_enabled(void)
+{
+#ifdef THREETOOLS_PROFILE
+    return 1U;
+#else
+    return 0U;
+#endif
+}
+/*  End of profiling_enabled.                                                 */
@@ -0,0 +1,136 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides helpers for the levels of a level-of-detail canvas pyramid.  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_PYRAMID_H
+#define THREETOOLS_PYRAMID_H
+
+/*  CanvasParameters typedef and CANVAS_PYRAMID_MAX_LEVELS provided here.     */
+#include <threetools/types.h>
+
+/*  Coarser levels never have fewer than two points along an axis, so that    *
+ *  every level still has line segments.                                      */
+#define PYRAMID_MIN_POINTS (2U)
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      pyramid_level_points                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the number of points along one axis of a level of a pyramid. *
+ *  Arguments:                                                                *
+ *      points (unsigned int):                                                *
+ *          The number of points along the axis of the full grid.             *
+ *      level (unsigned int):                                                 *
+ *          The level, zero for the full grid.                                *
+ *  Output:                                                                   *
+ *      level_points (unsigned int):                                          *
+ *          The points along the axis, halved once per level, but no fewer    *
+ *          than PYRAMID_MIN_POINTS. Grids that start out smaller are left as *
+ *          is.                                                               *
+ ******************************************************************************/
+static inline unsigned int
+pyramid_level_points(unsigned int points, unsigned int level)
+{
+    const unsigned int halved = points >> level;
+
+    if (points < PYRAMID_MIN_POINTS)
+        return points;
+
+    return (halved < PYRAMID_MIN_POINTS ? PYRAMID_MIN_POINTS : halved);
+}
+/*  End of pyramid_level_points.                                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      pyramid_level_count                                                   *
+ *  Purpose:                                                                  *
+ *      Computes the number of levels a pyramid for a grid has.               *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the full grid.                                 *
+ *      number_of_levels (unsigned int):                                      *
+ *          The number of levels requested.                                   *
+ *  Output:                                                                   *
+ *      count (unsigned int):                                                 *
+ *          The number of levels, between one and CANVAS_PYRAMID_MAX_LEVELS.  *
+ *          Levels are only added while they are smaller than the one before, *
+ *          a 16 x 16 grid has at most the levels 16, 8, 4, and 2.            *
+ ******************************************************************************/
+static inline unsigned int
+pyramid_level_count(const CanvasParameters * const parameters,
+                    unsigned int number_of_levels)
+{
+    unsigned int count = 1U;
+
+    if (number_of_levels > CANVAS_PYRAMID_MAX_LEVELS)
+        number_of_levels = CANVAS_PYRAMID_MAX_LEVELS;
+
+    while (count < number_of_levels)
+    {
+        const unsigned int previous = count - 1U;
+
+        /*  Stop once halving no longer shrinks the grid.                     */
+        if (pyramid_level_points(parameters->nx_pts, count) ==
+                pyramid_level_points(parameters->nx_pts, previous) &&
+            pyramid_level_points(parameters->ny_pts, count) ==
+                pyramid_level_points(parameters->ny_pts, previous))
+            break;
+
+        ++count;
+    }
+
+    return count;
+}
+/*  End of pyramid_level_count.                                               */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      pyramid_level_parameters                                              *
+ *  Purpose:                                                                  *
+ *      Computes the parameters for a level of a pyramid.                     *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the full grid.                                 *
+ *      level (unsigned int):                                                 *
+ *          The level, zero for the full grid.                                *
+ *  Output:                                                                   *
+ *      level_parameters (CanvasParameters):                                  *
+ *          The same parameters with the size of the grid for the level. The  *
+ *          domain is unchanged, so every level covers the same part of the   *
+ *          surface.                                                          *
+ ******************************************************************************/
+static inline CanvasParameters
+pyramid_level_parameters(const CanvasParameters * const parameters,
+                         unsigned int level)
+{
+    CanvasParameters level_parameters = *parameters;
+    level_parameters.nx_pts = pyramid_level_points(parameters->nx_pts, level);
+    level_parameters.ny_pts = pyramid_level_points(parameters->ny_pts, level);
+    return level_parameters;
+}
+/*  End of pyramid_level_parameters.                                          */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Resets the back buffer inside a canvas.                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free and NULL are provided here.                                          */
+#include <stdlib.h>
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_back_buffer                                                     *
+ *  Purpose:                                                                  *
+ *      Resets the second output buffer, making the canvas double buffered.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose back buffer is being reset.                      *
+ *      buffer (float *):                                                     *
+ *          The buffer where the canvas stores the other frame. If NULL, the  *
+ *          canvas allocates its own buffer.                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The mesh size must be set, using reset_mesh_buffer, before calling    *
+ *      this. If the allocation fails the back buffer is set to NULL. Once    *
+ *      set, allocate_canvas keeps the back buffer the same size as the output*
+ *      buffer.                                                               *
+ ******************************************************************************/
+void reset_back_buffer(Canvas *canvas, float *buffer)
+{
+    /*  The back buffer holds a second copy of the output, allocate one of    *
+     *  the same size if no buffer was provided.                              */
+    if (!buffer)
+    {
+        canvas->back_output = resize_buffer(
+            canvas->back_output, &canvas->back_output_capacity,
+            canvas->mesh_size, sizeof(*canvas->back_output)
+        );
+
+        return;
+    }
+
+    /*  The caller is providing the storage. Release anything we own.         */
+    if (canvas->back_output_capacity != 0U)
+    {
+        free(canvas->back_output);
+        canvas->back_output_capacity = 0U;
+    }
+
+    /*  Only the pointer needs to be updated.                                 */
+    canvas->back_output = buffer;
+}
+/*  End of reset_back_buffer.                                                 */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Resets the color buffer for a canvas.                                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free and NULL are provided here.                                          */
+#include <stdlib.h>
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_color_buffer                                                    *
+ *  Purpose:                                                                  *
+ *      Resets the color buffer, giving the canvas per-vertex colors.         *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose color buffer is being reset.                     *
+ *      buffer (unsigned char *):                                             *
+ *          The buffer where the canvas stores its colors. If NULL, the canvas*
+ *          allocates its own buffer.                                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The number of points must be set, using reset_mesh_buffer, before     *
+ *      calling this. If the allocation fails the color buffer is set to NULL.*
+ *      Once set, allocate_canvas keeps the color buffer sized for the mesh.  *
+ *      The colors are not computed here, see set_canvas_color_map.           *
+ ******************************************************************************/
+void reset_color_buffer(Canvas *canvas, unsigned char *buffer)
+{
+    /*  Three bytes per point, a quarter of the size of the output buffer.    *
+     *  Allocate one if no buffer was provided.                               */
+    if (!buffer)
+    {
+        canvas->colors = resize_buffer(
+            canvas->colors, &canvas->colors_capacity,
+            3U * canvas->number_of_points, sizeof(*canvas->colors)
+        );
+
+        return;
+    }
+
+    /*  The caller is providing the storage. Release anything we own.         */
+    if (canvas->colors_capacity != 0U)
+    {
+        free(canvas->colors);
+        canvas->colors_capacity = 0U;
+    }
+
+    /*  Only the pointer needs to be updated.                                 */
+    canvas->colors = buffer;
+}
+/*  End of reset_color_buffer.                                                */
@@ -23,6 +23,9 @@
  *  Date:       November 23, 2025                                             *
  ******************************************************************************/
 
+/*  free and NULL are provided here.                                          */
+#include <stdlib.h>
+
 /*  Canvas typedef found here.                                                */
 #include <threetools/types.h>
 
@@ -37,17 +40,58 @@
  *  Arguments:                                                                *
  *      canvas (Canvas *):                                                    *
  *          The canvas that is being resized.                                 *
- *      buffer (unsigned int *):                                              *
- *          The buffer where the canvas will store its data.                  *
+ *      buffer (void *):                                                      *
+ *          The buffer where the canvas will store its data. If NULL, the     *
+ *          canvas allocates its own buffer, reusing its current one if it is *
+ *          big enough. Provided buffers must match the index type.           *
  *  Output:                                                                   *
  *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If the allocation fails the index pointer is set to NULL and the index*
+ *      size is set to zero.                                                  *
  ******************************************************************************/
-void reset_index_buffer(Canvas *canvas, unsigned int *buffer)
+void reset_index_buffer(Canvas *canvas, void *buffer)
 {
-    /*  The size of the index buffer depends on the mesh type. Compute this.  */
+    /*  The size of the index buffer depends on the mesh type, and the type   *
+     *  of the elements on the number of points. Compute these.               */
     compute_index_size(canvas);
 
-    /*  Reset the index buffer to use the one provided.                       */
+    /*  No buffer provided, use storage owned by the canvas.                  */
+    if (!buffer)
+    {
+        const unsigned int old_capacity = canvas->index_capacity;
+
+        const size_t index_element_size =
+            canvas->index_type == Uint16Indices ? sizeof(unsigned short)
+                                                : sizeof(unsigned int);
+
+        canvas->indices = resize_buffer(
+            canvas->indices, &canvas->index_capacity,
+            canvas->index_size, index_element_size
+        );
+
+        /*  The capacity only changes if a new buffer was allocated. Its      *
+         *  contents are garbage, so the cached wireframe is no longer valid. */
+        if (canvas->index_capacity != old_capacity)
+            invalidate_index_topology(canvas);
+
+        /*  Check if the allocation failed. Empty the index buffer if so.     */
+        if (!canvas->indices)
+            canvas->index_size = 0U;
+
+        return;
+    }
+
+    /*  The caller is providing the storage. Release anything we own.         */
+    if (canvas->index_capacity != 0U)
+    {
+        free(canvas->indices);
+        canvas->index_capacity = 0U;
+    }
+
+    /*  Reset the index buffer to use the one provided. Nothing is known      *
+     *  about its contents.                                                   */
     canvas->indices = buffer;
+    invalidate_index_topology(canvas);
 }
 /*  End of reset_index_buffer.                                                */
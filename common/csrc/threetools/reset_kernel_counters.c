@@ -0,0 +1,57 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sets all of the profiling counters back to zero.                      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The kernel_counters global is declared here.                              */
+#include <threetools/globals.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_kernel_counters                                                 *
+ *  Purpose:                                                                  *
+ *      Sets the counters of every kernel back to zero.                       *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Useful for measuring a single part of an animation, like the frames   *
+ *      after a slider has moved.                                             *
+ ******************************************************************************/
+void reset_kernel_counters(void)
+{
+    /*  Variable for indexing over the kernels.                               */
+    unsigned int index;
+
+    for (index = 0U; index < PROFILE_KERNEL_COUNT; ++index)
+    {
+        kernel_counters[index].calls = 0.0;
+        kernel_counters[index].points = 0.0;
+        kernel_counters[index].nanoseconds = 0.0;
+    }
+}
+/*  End of reset_kernel_counters.                                             */
@@ -23,6 +23,9 @@
  *  Date:       November 23, 2025                                             *
  ******************************************************************************/
 
+/*  free and NULL are provided here.                                          */
+#include <stdlib.h>
+
 /*  Canvas typedef found here.                                                */
 #include <threetools/types.h>
 
@@ -38,9 +41,14 @@
  *      canvas (Canvas *):                                                    *
  *          The canvas that is being resized.                                 *
  *      buffer (float *):                                                     *
- *          The buffer where the canvas will store its data.                  *
+ *          The buffer where the canvas will store its data. If NULL, the     *
+ *          canvas allocates its own buffer, reusing its current one if it is *
+ *          big enough.                                                       *
  *  Output:                                                                   *
  *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If the allocation fails the mesh pointer is set to NULL and the mesh  *
+ *      size is set to zero.                                                  *
  ******************************************************************************/
 void reset_mesh_buffer(Canvas *canvas, float *buffer)
 {
@@ -52,6 +60,31 @@ void reset_mesh_buffer(Canvas *canvas, float *buffer)
      *  The mesh size is hence three times the number of points.              */
     canvas->mesh_size = 3U * canvas->number_of_points;
 
+    /*  No buffer provided, use storage owned by the canvas.                  */
+    if (!buffer)
+    {
+        canvas->mesh = resize_buffer(
+            canvas->mesh, &canvas->mesh_capacity,
+            canvas->mesh_size, sizeof(*canvas->mesh)
+        );
+
+        /*  Check if the allocation failed. Empty the mesh if so.             */
+        if (!canvas->mesh)
+        {
+            canvas->number_of_points = 0U;
+            canvas->mesh_size = 0U;
+        }
+
+        return;
+    }
+
+    /*  The caller is providing the storage. Release anything we own.         */
+    if (canvas->mesh_capacity != 0U)
+    {
+        free(canvas->mesh);
+        canvas->mesh_capacity = 0U;
+    }
+
     /*  Reset the mesh buffer to use the provided pointer.                    */
     canvas->mesh = buffer;
 }
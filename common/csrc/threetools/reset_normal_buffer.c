@@ -0,0 +1,79 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Resets the normal buffer for a canvas.                                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free and NULL are provided here.                                          */
+#include <stdlib.h>
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_normal_buffer                                                   *
+ *  Purpose:                                                                  *
+ *      Resets the normal buffer, giving the canvas per-vertex normals.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose normal buffer is being reset.                    *
+ *      buffer (float *):                                                     *
+ *          The buffer where the canvas stores its normals. If NULL, the      *
+ *          canvas allocates its own buffer.                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The mesh size must be set, using reset_mesh_buffer, before calling    *
+ *      this. If the allocation fails the normal buffer is set to NULL. Once  *
+ *      set, allocate_canvas keeps the normal buffer the same size as the     *
+ *      output buffer. The normals are not computed here, see                 *
+ *      compute_canvas_normals.                                               *
+ ******************************************************************************/
+void reset_normal_buffer(Canvas *canvas, float *buffer)
+{
+    /*  There is one interleaved normal per point, the same size as the       *
+     *  output. Allocate one if no buffer was provided.                       */
+    if (!buffer)
+    {
+        canvas->normals = resize_buffer(
+            canvas->normals, &canvas->normals_capacity,
+            canvas->mesh_size, sizeof(*canvas->normals)
+        );
+
+        return;
+    }
+
+    /*  The caller is providing the storage. Release anything we own.         */
+    if (canvas->normals_capacity != 0U)
+    {
+        free(canvas->normals);
+        canvas->normals_capacity = 0U;
+    }
+
+    /*  Only the pointer needs to be updated.                                 */
+    canvas->normals = buffer;
+}
+/*  End of reset_normal_buffer.                                               */
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Resets the output buffer inside a canvas.                             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  free and NULL are provided here.                                          */
+#include <stdlib.h>
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_output_buffer                                                   *
+ *  Purpose:                                                                  *
+ *      Resets the buffer the canvas is rendered from.                        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose output buffer is being reset.                    *
+ *      buffer (float *):                                                     *
+ *          The buffer where the canvas will store its interleaved vertices.  *
+ *          For interleaved meshes this is the mesh buffer itself. If NULL,   *
+ *          the canvas allocates its own buffer.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The mesh size must be set, using reset_mesh_buffer, before calling    *
+ *      this. If the allocation fails the output pointer is set to NULL.      *
+ ******************************************************************************/
+void reset_output_buffer(Canvas *canvas, float *buffer)
+{
+    /*  The output buffer has the same number of elements as the mesh, but is *
+     *  always interleaved. Allocate one if no buffer was provided.           */
+    if (!buffer)
+    {
+        canvas->output = resize_buffer(
+            canvas->output, &canvas->output_capacity,
+            canvas->mesh_size, sizeof(*canvas->output)
+        );
+
+        return;
+    }
+
+    /*  The caller is providing the storage, which is usually the mesh        *
+     *  buffer. Release anything we own.                                      */
+    if (canvas->output_capacity != 0U)
+    {
+        free(canvas->output);
+        canvas->output_capacity = 0U;
+    }
+
+    /*  Only the pointer needs to be updated.                                 */
+    canvas->output = buffer;
+}
+/*  End of reset_output_buffer.                                               */
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Resizes a heap allocated buffer owned by a canvas.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  malloc and free are provided here.                                        */
+#include <stdlib.h>
+
+/*  size_t typedef found here.                                                */
+#include <stddef.h>
+
+/*  UINT_MAX macro provided here.                                             */
+#include <limits.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      resize_buffer                                                         *
+ *  Purpose:                                                                  *
+ *      Ensures a buffer has room for a given number of elements.             *
+ *  Arguments:                                                                *
+ *      buffer (void *):                                                      *
+ *          The current buffer. This is only freed if capacity is non-zero,   *
+ *          buffers that are not owned by the canvas are never freed.         *
+ *      capacity (unsigned int * const):                                      *
+ *          The size, in bytes, of the buffer, zero if the buffer is not      *
+ *          owned. This is updated with the new capacity.                     *
+ *      size (unsigned int):                                                  *
+ *          The number of elements that are needed.                           *
+ *      element_size (size_t):                                                *
+ *          The size, in bytes, of a single element.                          *
+ *  Output:                                                                   *
+ *      new_buffer (void *):                                                  *
+ *          A buffer with room for at least size elements, or NULL if the     *
+ *          allocation failed.                                                *
+ *  Notes:                                                                    *
+ *      The contents of the buffer are not preserved when it grows, every     *
+ *      caller regenerates the buffer after resizing it. Freeing before       *
+ *      allocating avoids copying and keeps the peak memory usage down.       *
+ *      Buffers never shrink, so toggling between two sizes does not          *
+ *      repeatedly hit the allocator. The capacity is measured in bytes since *
+ *      the index buffer may switch between 16-bit and 32-bit elements.       *
+ *      Sizes whose byte count does not fit in the capacity are rejected as   *
+ *      if malloc had failed. size_t is 32-bit on wasm32, so the product      *
+ *      would otherwise wrap around to a small, successful allocation.        *
+ ******************************************************************************/
+void *
+resize_buffer(void *buffer,
+              unsigned int * const capacity,
+              unsigned int size,
+              size_t element_size)
+{
+    /*  Too many elements for the capacity to hold the byte count. Checked    *
+     *  before the product is computed, since it may wrap around.             */
+    const int overflow = element_size != 0U && size > UINT_MAX / element_size;
+
+    /*  The number of bytes needed for the requested number of elements.      */
+    const size_t bytes = (size_t)size * element_size;
+
+    /*  If the buffer is already big enough, there is nothing to do.          */
+    if (!overflow && bytes <= *capacity)
+        return buffer;
+
+    /*  Free the old buffer, but only if it belongs to the canvas. Buffers    *
+     *  with zero capacity are static or owned by the caller.                 */
+    if (*capacity != 0U)
+        free(buffer);
+
+    /*  Allocate a buffer that is exactly the requested size. A size that     *
+     *  overflows is treated as a failed allocation.                          */
+    buffer = overflow ? NULL : malloc(bytes);
+
+    /*  Check if malloc failed. The canvas no longer owns anything if so.     */
+    if (!buffer)
+    {
+        *capacity = 0U;
+        return NULL;
+    }
+
+    *capacity = (unsigned int)bytes;
+
+    /*  The allocation may have grown the memory, detaching the views of the  *
+     *  JavaScript geometries. Let JavaScript know if so.                     */
+    check_memory_growth();
+    return buffer;
+}
+/*  End of resize_buffer.                                                     */
@@ -0,0 +1,103 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rotates an interleaved buffer of points about the z axis.             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  UnitVector typedef provided here.                                         */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  SIMD128 helpers, only used if compiled with -msimd128.                    */
+#include <threetools/simd.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_interleaved_buffer                                             *
+ *  Purpose:                                                                  *
+ *      Rotates an interleaved buffer of points, or vectors, about the z      *
+ *      axis.                                                                 *
+ *  Arguments:                                                                *
+ *      buffer (float * const):                                               *
+ *          The points, (x0, y0, z0, x1, y1, z1, ...), rotated in place.      *
+ *      number_of_points (unsigned int):                                      *
+ *          The number of points in the buffer.                               *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If SIMD128 is available, four points are rotated at a time. The       *
+ *      remaining zero to three points are handled by the scalar loop. This   *
+ *      is used for interleaved meshes and for the normals of a canvas, a     *
+ *      rotation turns the normals of a surface the same way as its points.   *
+ ******************************************************************************/
+void
+rotate_interleaved_buffer(float * const buffer,
+                          unsigned int number_of_points,
+                          UnitVector point)
+{
+    /*  Variable for indexing over the points in the buffer.                  */
+    unsigned int index = 0U;
+
+#if defined(__wasm_simd128__)
+
+    /*  The sine and cosine are the same for every point, splat them.         */
+    const v128_t cos_angle = wasm_f32x4_splat(point.cos_angle);
+    const v128_t sin_angle = wasm_f32x4_splat(point.sin_angle);
+
+    /*  Four points are twelve floats, or three 128-bit vectors.              */
+    for (; index + 4U <= number_of_points; index += 4U)
+    {
+        /*  Pointer to the x component of the first of the four points.       */
+        float * const data = buffer + 3U * index;
+
+        /*  Rotate the four points in place.                                  */
+        simd_rotate_xy4(data, data, cos_angle, sin_angle);
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < number_of_points; ++index)
+    {
+        /*  A vertex has three values, the x, y, and z coordinates. The index *
+         *  for the x value of the point is 3 times the current index.        */
+        const unsigned int x_index = 3U * index;
+
+        /*  The y index is immediately after the x index.                     */
+        const unsigned int y_index = x_index + 1U;
+
+        /*  Use the rotation matrix. Get the initial values.                  */
+        const float x = buffer[x_index];
+        const float y = buffer[y_index];
+
+        /*  Apply the rotation matrix and update the points.                  */
+        buffer[x_index] = point.cos_angle * x - point.sin_angle * y;
+        buffer[y_index] = point.cos_angle * y + point.sin_angle * x;
+    }
+}
+/*  End of rotate_interleaved_buffer.                                         */
@@ -27,11 +27,17 @@
 /*  Function prototype / forward declaration given here.                      */
 #include <threetools/threetools.h>
 
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/*  SIMD128 helpers, only used if compiled with -msimd128.                    */
+#include <threetools/simd.h>
+
 /******************************************************************************
  *  Function:                                                                 *
- *      rotate_mesh                                                           *
+ *      rotate_planar_mesh                                                    *
  *  Purpose:                                                                  *
- *      Rotates the mesh in a canvas by the provided unit vector.             *
+ *      Rotates a planar mesh by the provided unit vector.                    *
  *  Arguments:                                                                *
  *      canvas (Canvas *):                                                    *
  *          The canvas with the mesh that is being rotated.                   *
@@ -39,29 +45,92 @@
  *          A point on the unit circle, its polar angle is used for rotating. *
  *  Output:                                                                   *
  *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Only the x and y planes are read and written. Both are contiguous, so *
+ *      the SIMD loop is a plain load, multiply-add, and store.               *
  ******************************************************************************/
-void rotate_mesh(Canvas *canvas, UnitVector point)
+static void rotate_planar_mesh(Canvas *canvas, UnitVector point)
 {
     /*  Variable for indexing over the elements of the mesh.                  */
-    unsigned int index;
+    unsigned int index = 0U;
+
+    /*  The x values are first, the y values immediately follow.              */
+    float * const x = canvas->mesh;
+    float * const y = x + canvas->number_of_points;
+
+#if defined(__wasm_simd128__)
+
+    /*  The sine and cosine are the same for every point, splat them.         */
+    const v128_t cos_angle = wasm_f32x4_splat(point.cos_angle);
+    const v128_t sin_angle = wasm_f32x4_splat(point.sin_angle);
 
-    /*  Loop through each point in the mesh.                                  */
-    for (index = 0; index < canvas->number_of_points; ++index)
+    /*  Rotate four points at a time.                                         */
+    for (; index + 4U <= canvas->number_of_points; index += 4U)
     {
-        /*  A vertex has three values, the x, y, and z coordinates. The index *
-         *  for the x value of the point is 3 times the current index.        */
-        const unsigned int x_index = 3U * index;
+        const v128_t xv = wasm_v128_load(x + index);
+        const v128_t yv = wasm_v128_load(y + index);
 
-        /*  The y index is immediately after the x index.                     */
-        const unsigned int y_index = x_index + 1U;
+        wasm_v128_store(
+            x + index,
+            wasm_f32x4_sub(
+                wasm_f32x4_mul(cos_angle, xv), wasm_f32x4_mul(sin_angle, yv)
+            )
+        );
 
+        wasm_v128_store(
+            y + index,
+            wasm_f32x4_add(
+                wasm_f32x4_mul(cos_angle, yv), wasm_f32x4_mul(sin_angle, xv)
+            )
+        );
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < canvas->number_of_points; ++index)
+    {
         /*  Use the rotation matrix. Get the initial values.                  */
-        const float x = canvas->mesh[x_index];
-        const float y = canvas->mesh[y_index];
+        const float x_val = x[index];
+        const float y_val = y[index];
 
         /*  Apply the rotation matrix and update the points.                  */
-        canvas->mesh[x_index] = point.cos_angle * x - point.sin_angle * y;
-        canvas->mesh[y_index] = point.cos_angle * y + point.sin_angle * x;
+        x[index] = point.cos_angle * x_val - point.sin_angle * y_val;
+        y[index] = point.cos_angle * y_val + point.sin_angle * x_val;
     }
 }
+/*  End of rotate_planar_mesh.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_mesh                                                           *
+ *  Purpose:                                                                  *
+ *      Rotates the mesh in a canvas by the provided unit vector.             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas with the mesh that is being rotated.                   *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Planar meshes are not packed into the output buffer by this function, *
+ *      see pack_planar_mesh.                                                 *
+ ******************************************************************************/
+void rotate_mesh(Canvas *canvas, UnitVector point)
+{
+    PROFILE_START;
+
+    /*  The kernel depends on how the mesh is stored.                         */
+    if (canvas->layout == PlanarLayout)
+        rotate_planar_mesh(canvas, point);
+    else
+        rotate_interleaved_buffer(
+            canvas->mesh, canvas->number_of_points, point
+        );
+
+    PROFILE_STOP(RotateMeshKernel, canvas->number_of_points);
+}
 /*  End of rotate_mesh.                                                       */
@@ -0,0 +1,199 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rotates the mesh of a canvas into its output buffer.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and UnitVector typedefs provided here.                             */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/*  SIMD128 helpers, only used if compiled with -msimd128.                    */
+#include <threetools/simd.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_interleaved_to_output                                          *
+ *  Purpose:                                                                  *
+ *      Writes an interleaved mesh, rotated by the provided unit vector, into *
+ *      the output buffer.                                                    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being rotated.                   *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+rotate_interleaved_to_output(Canvas * const canvas, UnitVector point)
+{
+    /*  Variable for indexing over the elements of the mesh.                  */
+    unsigned int index = 0U;
+
+#if defined(__wasm_simd128__)
+
+    /*  The sine and cosine are the same for every point, splat them.         */
+    const v128_t cos_angle = wasm_f32x4_splat(point.cos_angle);
+    const v128_t sin_angle = wasm_f32x4_splat(point.sin_angle);
+
+    /*  Four points are twelve floats, or three 128-bit vectors.              */
+    for (; index + 4U <= canvas->number_of_points; index += 4U)
+    {
+        /*  The input and output have the same layout, use the same offset.   */
+        const unsigned int offset = 3U * index;
+
+        simd_rotate_xy4(
+            canvas->mesh + offset, canvas->output + offset, cos_angle, sin_angle
+        );
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < canvas->number_of_points; ++index)
+    {
+        /*  Indices for the x, y, and z components of the point.              */
+        const unsigned int x_index = 3U * index;
+        const unsigned int y_index = x_index + 1U;
+        const unsigned int z_index = x_index + 2U;
+
+        /*  The original, unrotated, values.                                  */
+        const float x = canvas->mesh[x_index];
+        const float y = canvas->mesh[y_index];
+
+        /*  Apply the rotation matrix and write to the output.                */
+        canvas->output[x_index] = point.cos_angle * x - point.sin_angle * y;
+        canvas->output[y_index] = point.cos_angle * y + point.sin_angle * x;
+        canvas->output[z_index] = canvas->mesh[z_index];
+    }
+}
+/*  End of rotate_interleaved_to_output.                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_planar_to_output                                               *
+ *  Purpose:                                                                  *
+ *      Writes a planar mesh, rotated by the provided unit vector, into the   *
+ *      interleaved output buffer. This is a single fused read, transform, and*
+ *      write.                                                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being rotated.                   *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void rotate_planar_to_output(Canvas * const canvas, UnitVector point)
+{
+    /*  Variable for indexing over the elements of the mesh.                  */
+    unsigned int index = 0U;
+
+    /*  Pointers to the three planes of the mesh.                             */
+    const float * const x = canvas->mesh;
+    const float * const y = x + canvas->number_of_points;
+    const float * const z = y + canvas->number_of_points;
+
+#if defined(__wasm_simd128__)
+
+    /*  The sine and cosine are the same for every point, splat them.         */
+    const v128_t cos_angle = wasm_f32x4_splat(point.cos_angle);
+    const v128_t sin_angle = wasm_f32x4_splat(point.sin_angle);
+
+    /*  Rotate four points at a time. Each plane is contiguous.               */
+    for (; index + 4U <= canvas->number_of_points; index += 4U)
+    {
+        const v128_t xv = wasm_v128_load(x + index);
+        const v128_t yv = wasm_v128_load(y + index);
+        const v128_t zv = wasm_v128_load(z + index);
+
+        const v128_t x_rot = wasm_f32x4_sub(
+            wasm_f32x4_mul(cos_angle, xv), wasm_f32x4_mul(sin_angle, yv)
+        );
+
+        const v128_t y_rot = wasm_f32x4_add(
+            wasm_f32x4_mul(cos_angle, yv), wasm_f32x4_mul(sin_angle, xv)
+        );
+
+        /*  Interleave the result and write it to the output buffer.          */
+        simd_store_xyz4(canvas->output + 3U * index, x_rot, y_rot, zv);
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < canvas->number_of_points; ++index)
+    {
+        /*  Index for the x component of the point in the output buffer.      */
+        const unsigned int x_index = 3U * index;
+
+        /*  Apply the rotation matrix and write to the output.                */
+        canvas->output[x_index] =
+            point.cos_angle * x[index] - point.sin_angle * y[index];
+
+        canvas->output[x_index + 1U] =
+            point.cos_angle * y[index] + point.sin_angle * x[index];
+
+        canvas->output[x_index + 2U] = z[index];
+    }
+}
+/*  End of rotate_planar_to_output.                                           */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_mesh_to_output                                                 *
+ *  Purpose:                                                                  *
+ *      Writes the mesh of a canvas, rotated by the provided unit vector, into*
+ *      the output buffer. The mesh itself is not modified.                   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being rotated.                   *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The output buffer must be different from the mesh buffer.             *
+ ******************************************************************************/
+void rotate_mesh_to_output(Canvas * const canvas, UnitVector point)
+{
+    PROFILE_START;
+
+    /*  The kernel depends on how the mesh is stored.                         */
+    if (canvas->layout == PlanarLayout)
+        rotate_planar_to_output(canvas, point);
+    else
+        rotate_interleaved_to_output(canvas, point);
+
+    PROFILE_STOP(RotateToOutputKernel, canvas->number_of_points);
+}
+/*  End of rotate_mesh_to_output.                                             */
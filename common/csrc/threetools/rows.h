@@ -0,0 +1,412 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides the loops that compute a band of rows of a mesh, shared by   *
+ *      the C functions and the templates in threetools.hpp.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_ROWS_H
+#define THREETOOLS_ROWS_H
+
+/*  NULL is provided here.                                                    */
+#include <stddef.h>
+
+/*  Canvas, Vec3, and AxisSample typedefs provided here.                      */
+#include <threetools/types.h>
+
+/*  grid_step and the gluing helpers provided here.                           */
+#include <threetools/gluing.h>
+
+/*  axis_sample and SEPARABLE_BATCH_SIZE provided here.                       */
+#include <threetools/separable.h>
+
+/*  write_color provided here, for canvases with a color map.                 */
+#include <threetools/color_map.h>
+
+/*  store_rectangular_row provided here, for the fused wireframe.             */
+#include <threetools/indices.h>
+
+/*  The surface is evaluated through a callback that is given the data        *
+ *  pointer of the row kernel. The C functions pass a pointer to the function *
+ *  pointer, and the templates a pointer to the functor. The loops below are  *
+ *  inlined into the row kernels, so for the templates the callback, and the  *
+ *  surface, are inlined into the loops as well.                              */
+typedef float
+(*HeightEvaluator)(const void * const data, float x, float y);
+
+typedef Vec3
+(*PointEvaluator)(const void * const data, float u, float v);
+
+typedef Vec3
+(*SeparableEvaluator)(const void * const data,
+                      const AxisSample * const u,
+                      const AxisSample * const v);
+
+/*  Where the components of a point are in the mesh of a canvas. Interleaved  *
+ *  meshes store a point as three consecutive floats. Planar meshes store the *
+ *  x values, then the y values, and then the z values.                       */
+typedef struct MeshOffsets {
+    unsigned int y_offset, z_offset, stride;
+} MeshOffsets;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      mesh_offsets                                                          *
+ *  Purpose:                                                                  *
+ *      Computes the offsets to the y and z components of a point, and the    *
+ *      step between consecutive points, for the layout of a canvas.          *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas whose mesh is being written to.                        *
+ *  Output:                                                                   *
+ *      offsets (MeshOffsets):                                                *
+ *          The offsets and the stride, in floats.                            *
+ ******************************************************************************/
+static inline MeshOffsets mesh_offsets(const Canvas * const canvas)
+{
+    MeshOffsets offsets;
+
+    offsets.y_offset =
+        (canvas->layout == PlanarLayout ? canvas->number_of_points : 1U);
+
+    offsets.z_offset = 2U * offsets.y_offset;
+    offsets.stride = (canvas->layout == PlanarLayout ? 1U : 3U);
+    return offsets;
+}
+/*  End of mesh_offsets.                                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_parametric_rows                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a band of rows of a mesh z = f(x, y), and    *
+ *      their colors if rgb is not NULL.                                      *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (HeightEvaluator):                                                  *
+ *          Evaluates the surface, given data.                                *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to f.                                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *      rgb (unsigned char *):                                                *
+ *          The color of the first point of the band, or NULL for no colors.  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The callers pass rgb as NULL or not at compile time, so that the      *
+ *      check is folded away once this is inlined. The height is still in a   *
+ *      register when it is colored, so the mesh is not read back.            *
+ ******************************************************************************/
+static inline void
+store_parametric_rows(Canvas * const canvas,
+                      HeightEvaluator f,
+                      const void * const data,
+                      unsigned int first_row,
+                      unsigned int end_row,
+                      unsigned char *rgb)
+{
+    /*  Step sizes in the horizontal and vertical axes.                       */
+    const float dx = canvas->width / (float)(canvas->nx_pts - 1U);
+    const float dy = canvas->height / (float)(canvas->ny_pts - 1U);
+
+    /*  Where the y and z components are, for the layout of the mesh.         */
+    const MeshOffsets offsets = mesh_offsets(canvas);
+
+    /*  Variables for indexing the horizontal and vertical axes.              */
+    unsigned int x_index, y_index;
+
+    /*  Variable for indexing over the array being written to, starting at    *
+     *  the first point of the first row in the band.                         */
+    unsigned int index = first_row * canvas->nx_pts * offsets.stride;
+
+    /*  Loop over the vertical axis. The surface is of the form z = f(x, y).  *
+     *  Note, since the y index is the outer for-loop, the array is indexed   *
+     *  in row-major fashion. That is, index = y * width + x.                 */
+    for (y_index = first_row; y_index < end_row; ++y_index)
+    {
+        /*  Convert pixel index to y coordinate.                              */
+        const float y = canvas->vertical_start + (float)(y_index) * dy;
+
+        /*  Loop through the horizontal component of the object.              */
+        for (x_index = 0U; x_index < canvas->nx_pts; ++x_index)
+        {
+            /*  Convert pixel index to x coordinate in the plane.             */
+            const float x = canvas->horizontal_start + (float)(x_index) * dx;
+
+            /*  Get the z component using the provided parametrization.       */
+            const float z = f(data, x, y);
+
+            /*  Add this point to our vertex array.                           */
+            canvas->mesh[index] = x;
+            canvas->mesh[index + offsets.y_offset] = y;
+            canvas->mesh[index + offsets.z_offset] = z;
+            index += offsets.stride;
+
+            /*  Colors are always packed, three bytes per point.              */
+            if (rgb)
+            {
+                write_color(canvas->color_map, z, rgb);
+                rgb += 3U;
+            }
+        }
+        /*  End of horizontal for-loop.                                       */
+    }
+    /*  End of vertical for-loop.                                             */
+}
+/*  End of store_parametric_rows.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parametric_colors                                                     *
+ *  Purpose:                                                                  *
+ *      Finds where the colors of a row start, for canvases with a color map. *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas being colored.                                         *
+ *      row (unsigned int):                                                   *
+ *          The row whose first color is wanted.                              *
+ *  Output:                                                                   *
+ *      rgb (unsigned char *):                                                *
+ *          The color of the first point of the row, or NULL if the canvas    *
+ *          has no colors or no color map.                                    *
+ ******************************************************************************/
+static inline unsigned char *
+parametric_colors(const Canvas * const canvas, unsigned int row)
+{
+    if (!canvas->colors || !canvas->color_map)
+        return NULL;
+
+    return canvas->colors + 3U * row * canvas->nx_pts;
+}
+/*  End of parametric_colors.                                                 */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_fused_rows                                                      *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a band of rows of a mesh z = f(x, y),        *
+ *      writing the line segments of each row right after its vertices.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (HeightEvaluator):                                                  *
+ *          Evaluates the surface, given data.                                *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to f.                                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is store_parametric_rows and generate_rectangular_rows in one    *
+ *      loop. Colors are written with the vertices if the canvas has a color  *
+ *      map.                                                                  *
+ ******************************************************************************/
+static inline void
+store_fused_rows(Canvas * const canvas,
+                 HeightEvaluator f,
+                 const void * const data,
+                 unsigned int first_row,
+                 unsigned int end_row)
+{
+    const int colored = parametric_colors(canvas, first_row) != NULL;
+    unsigned int y_index;
+
+    for (y_index = first_row; y_index < end_row; ++y_index)
+    {
+        /*  Two calls, so that each has a constant rgb, see above.            */
+        if (colored)
+            store_parametric_rows(
+                canvas, f, data, y_index, y_index + 1U,
+                parametric_colors(canvas, y_index)
+            );
+
+        else
+            store_parametric_rows(
+                canvas, f, data, y_index, y_index + 1U, NULL
+            );
+
+        /*  The row was just written and is still in cache, add its edges.    */
+        store_rectangular_row(canvas, y_index);
+    }
+}
+/*  End of store_fused_rows.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_surface_rows                                                    *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a band of rows of a mesh (u, v) -> (x, y, z).*
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (PointEvaluator):                                                   *
+ *          Evaluates the surface, given data.                                *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to f.                                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Axes that are glued by the mesh type are sampled periodically.        *
+ ******************************************************************************/
+static inline void
+store_surface_rows(Canvas * const canvas,
+                   PointEvaluator f,
+                   const void * const data,
+                   unsigned int first_row,
+                   unsigned int end_row)
+{
+    /*  Step sizes in the horizontal and vertical axes.                       */
+    const EdgeGluing horizontal = horizontal_gluing(canvas->mesh_type);
+    const EdgeGluing vertical = vertical_gluing(canvas->mesh_type);
+    const float du = grid_step(canvas->width, canvas->nx_pts, horizontal);
+    const float dv = grid_step(canvas->height, canvas->ny_pts, vertical);
+
+    /*  Where the y and z components are, for the layout of the mesh.         */
+    const MeshOffsets offsets = mesh_offsets(canvas);
+
+    /*  Variables for indexing the horizontal and vertical axes.              */
+    unsigned int u_index, v_index;
+
+    /*  Variable for indexing over the array being written to, starting at    *
+     *  the first point of the first row in the band.                         */
+    unsigned int index = first_row * canvas->nx_pts * offsets.stride;
+
+    /*  Loop over the grid in row-major fashion, index = v * width + u.       */
+    for (v_index = first_row; v_index < end_row; ++v_index)
+    {
+        const float v = canvas->vertical_start + (float)(v_index) * dv;
+
+        for (u_index = 0U; u_index < canvas->nx_pts; ++u_index)
+        {
+            const float u = canvas->horizontal_start + (float)(u_index) * du;
+            const Vec3 point = f(data, u, v);
+
+            canvas->mesh[index] = point.x;
+            canvas->mesh[index + offsets.y_offset] = point.y;
+            canvas->mesh[index + offsets.z_offset] = point.z;
+            index += offsets.stride;
+        }
+        /*  End of horizontal for-loop.                                       */
+    }
+    /*  End of vertical for-loop.                                             */
+}
+/*  End of store_surface_rows.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_separable_rows                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a band of rows of a separable surface.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (SeparableEvaluator):                                               *
+ *          Evaluates the surface, given data.                                *
+ *      data (const void * const):                                            *
+ *          The surface, passed on to f.                                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The grid is sampled the same way as in store_surface_rows. The columns*
+ *      are the outer loop so that each column is sampled once per band,      *
+ *      rather than once per row. Rows narrower than the batch size, which is *
+ *      almost all of them, are a single batch.                               *
+ ******************************************************************************/
+static inline void
+store_separable_rows(Canvas * const canvas,
+                     SeparableEvaluator f,
+                     const void * const data,
+                     unsigned int first_row,
+                     unsigned int end_row)
+{
+    /*  Step sizes in the horizontal and vertical axes.                       */
+    const EdgeGluing horizontal = horizontal_gluing(canvas->mesh_type);
+    const EdgeGluing vertical = vertical_gluing(canvas->mesh_type);
+    const float du = grid_step(canvas->width, canvas->nx_pts, horizontal);
+    const float dv = grid_step(canvas->height, canvas->ny_pts, vertical);
+
+    /*  Where the y and z components are, for the layout of the mesh.         */
+    const MeshOffsets offsets = mesh_offsets(canvas);
+
+    /*  Samples for the columns in the current batch.                         */
+    AxisSample u[SEPARABLE_BATCH_SIZE];
+
+    /*  Variables for indexing the batches, the columns, and the rows.        */
+    unsigned int start, n, v_index;
+
+    for (start = 0U; start < canvas->nx_pts; start += SEPARABLE_BATCH_SIZE)
+    {
+        /*  The last batch may be narrower than the others.                   */
+        const unsigned int remaining = canvas->nx_pts - start;
+        const unsigned int length =
+            remaining < SEPARABLE_BATCH_SIZE ? remaining
+                                             : SEPARABLE_BATCH_SIZE;
+
+        for (n = 0U; n < length; ++n)
+            u[n] = axis_sample(
+                canvas->horizontal_start + (float)(start + n) * du
+            );
+
+        for (v_index = first_row; v_index < end_row; ++v_index)
+        {
+            const AxisSample v =
+                axis_sample(canvas->vertical_start + (float)(v_index) * dv);
+
+            /*  Index of the first point of the batch in this row.            */
+            unsigned int index =
+                (v_index * canvas->nx_pts + start) * offsets.stride;
+
+            for (n = 0U; n < length; ++n)
+            {
+                const Vec3 point = f(data, u + n, &v);
+
+                canvas->mesh[index] = point.x;
+                canvas->mesh[index + offsets.y_offset] = point.y;
+                canvas->mesh[index + offsets.z_offset] = point.z;
+                index += offsets.stride;
+            }
+            /*  End of horizontal for-loop.                                   */
+        }
+        /*  End of vertical for-loop.                                         */
+    }
+    /*  End of loop over the batches of columns.                              */
+}
+/*  End of store_separable_rows.                                              */
+
+#endif
+/*  End of include guard.                                                     */
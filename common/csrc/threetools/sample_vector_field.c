@@ -0,0 +1,95 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Evaluates a vector field over the points of a grid.                   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Vec3, VectorField, and VectorFieldGrid typedefs found here.               */
+#include <threetools/types.h>
+
+/*  sample_field_grid and FieldEvaluator provided here.                       */
+#include <threetools/vector_field.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_field                                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates a VectorField passed by address.                            *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the VectorField being sampled.                         *
+ *      position (Vec3):                                                      *
+ *          The point the field is evaluated at.                              *
+ *      time (float):                                                         *
+ *          The time the field is evaluated at.                               *
+ *  Output:                                                                   *
+ *      field (Vec3):                                                         *
+ *          The value of the field.                                           *
+ *  Notes:                                                                    *
+ *      Function pointers can not be stored in a void pointer.                *
+ ******************************************************************************/
+static Vec3
+evaluate_field(const void * const data, Vec3 position, float time)
+{
+    const VectorField f = *(const VectorField *)data;
+    return f(position, time);
+}
+/*  End of evaluate_field.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      sample_vector_field                                                   *
+ *  Purpose:                                                                  *
+ *      Evaluates a vector field at every point of a grid, writing the arrows *
+ *      to the instance buffer.                                               *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid, from allocate_vector_field or create_vector_field.      *
+ *      f (const VectorField):                                                *
+ *          The vector field being sampled.                                   *
+ *      time (float):                                                         *
+ *          The time the field is evaluated at, for animated fields.          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The positions never change, but they are written every time anyway.   *
+ *      They share a cache line with the direction, and it keeps the buffer a *
+ *      single upload. Each point is independent, so the loops have no        *
+ *      dependencies across iterations.                                       *
+ ******************************************************************************/
+void
+sample_vector_field(VectorFieldGrid * const grid,
+                    const VectorField f,
+                    float time)
+{
+    /*  Timer for the whole grid, the field is evaluated at every point.      */
+    PROFILE_START;
+    sample_field_grid(grid, evaluate_field, &f, time);
+    PROFILE_STOP(VectorFieldKernel, grid->number_of_instances);
+}
+/*  End of sample_vector_field.                                               */
@@ -0,0 +1,73 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides helpers for sampling the axes of separable surfaces.         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_SEPARABLE_H
+#define THREETOOLS_SEPARABLE_H
+
+/*  cosf and sinf found here.                                                 */
+#include <math.h>
+
+/*  AxisSample typedef provided here.                                         */
+#include <threetools/types.h>
+
+/*  The number of columns whose samples are kept at once. Longer rows are     *
+ *  split into several batches of columns, and the table lives on the stack,  *
+ *  this keeps it small.                                                      */
+#define SEPARABLE_BATCH_SIZE (256U)
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      axis_sample                                                           *
+ *  Purpose:                                                                  *
+ *      Computes the trig values of a parameter of a separable surface.       *
+ *  Arguments:                                                                *
+ *      value (float):                                                        *
+ *          The parameter, u or v.                                            *
+ *  Output:                                                                   *
+ *      sample (AxisSample):                                                  *
+ *          The parameter, with the cosine and sine of it and of half of it.  *
+ *  Notes:                                                                    *
+ *      Only the half angle is computed with trig calls, the full angle is    *
+ *      found with the double angle formulas.                                 *
+ ******************************************************************************/
+static inline AxisSample axis_sample(float value)
+{
+    AxisSample sample;
+    sample.value = value;
+    sample.cos_half = cosf(0.5F * value);
+    sample.sin_half = sinf(0.5F * value);
+
+    /*  cos(2t) = cos^2(t) - sin^2(t) and sin(2t) = 2 sin(t) cos(t).          */
+    sample.cos_value =
+        sample.cos_half * sample.cos_half - sample.sin_half * sample.sin_half;
+
+    sample.sin_value = 2.0F * sample.sin_half * sample.cos_half;
+    return sample;
+}
+/*  End of axis_sample.                                                       */
+
+#endif
+/*  End of include guard.                                                     */
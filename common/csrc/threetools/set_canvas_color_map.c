@@ -0,0 +1,64 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sets the color map of a canvas, coloring its points.                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and ColorMap typedefs found here.                                  */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      set_canvas_color_map                                                  *
+ *  Purpose:                                                                  *
+ *      Sets the color map of a canvas, allocating its color buffer if needed.*
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being colored.                                         *
+ *      map (const ColorMap * const):                                         *
+ *          The color map, or NULL to stop coloring the canvas.               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The canvas does not own the color map, it must outlive the canvas or  *
+ *      be replaced first. The current mesh is colored right away. From then  *
+ *      on, generate_parametric_mesh colors the points in the same loop that  *
+ *      computes them.                                                        *
+ ******************************************************************************/
+void set_canvas_color_map(Canvas * const canvas, const ColorMap * const map)
+{
+    canvas->color_map = map;
+
+    /*  Without a map the colors keep their values, they are not updated.     */
+    if (!map)
+        return;
+
+    /*  The color buffer is allocated the first time a map is set.            */
+    if (!canvas->colors)
+        reset_color_buffer(canvas, NULL);
+
+    color_canvas(canvas);
+}
+/*  End of set_canvas_color_map.                                              */
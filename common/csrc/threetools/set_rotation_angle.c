@@ -51,6 +51,9 @@ void set_rotation_angle(float angle)
     /*  Compute the sine and cosine and save them in the global variable.     */
     rotation_vector.cos_angle = SMALL_ANGLE_COS(angle_squared);
     rotation_vector.sin_angle = SMALL_ANGLE_SIN(angle, angle_squared);
+
+    /*  Canvases with absolute rotations accumulate the angle, save it too.   */
+    rotation_angle = angle;
 }
 /*  End of set_rotation_angle.                                                */
 
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Sets the number of threads used for generating meshes.                *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The thread_count global and MAX_THREAD_COUNT macro are declared here.     */
+#include <threetools/globals.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      set_thread_count                                                      *
+ *  Purpose:                                                                  *
+ *      Sets the number of threads used by parallel_rows.                     *
+ *  Arguments:                                                                *
+ *      count (unsigned int):                                                 *
+ *          The requested number of threads. This is clamped to between one   *
+ *          and MAX_THREAD_COUNT.                                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The count is only used by builds with THREETOOLS_USE_PTHREADS, the    *
+ *      other builds always run on the calling thread. In the browser the     *
+ *      threads come from the emscripten worker pool, so the count should not *
+ *      exceed PTHREAD_POOL_SIZE.                                             *
+ ******************************************************************************/
+void set_thread_count(unsigned int count)
+{
+    if (count == 0U)
+        thread_count = 1U;
+
+    else if (count > MAX_THREAD_COUNT)
+        thread_count = MAX_THREAD_COUNT;
+
+    else
+        thread_count = count;
+}
+/*  End of set_thread_count.                                                  */
@@ -0,0 +1,245 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides small SIMD128 helpers shared by the mesh kernels.            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_SIMD_H
+#define THREETOOLS_SIMD_H
+
+/*  The SIMD build of libthreetools is compiled with -msimd128, which defines *
+ *  the __wasm_simd128__ macro. The helpers are only available then.          */
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      simd_load_xyz4                                                        *
+ *  Purpose:                                                                  *
+ *      Loads four interleaved points and splits them into their x, y, and z  *
+ *      components.                                                           *
+ *  Arguments:                                                                *
+ *      data (const float * const):                                           *
+ *          Pointer to the x component of the first point. Twelve floats are  *
+ *          read.                                                             *
+ *      x (v128_t * const):                                                   *
+ *          The x components of the four points.                              *
+ *      y (v128_t * const):                                                   *
+ *          The y components of the four points.                              *
+ *      z (v128_t * const):                                                   *
+ *          The z components of the four points.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static inline void
+simd_load_xyz4(const float * const data, v128_t * const x,
+               v128_t * const y, v128_t * const z)
+{
+    /*  The layout is interleaved, so the three vectors are given by:         *
+     *      v0 = (x0, y0, z0, x1)                                             *
+     *      v1 = (y1, z1, x2, y2)                                             *
+     *      v2 = (z2, x3, y3, z3)                                             */
+    const v128_t v0 = wasm_v128_load(data);
+    const v128_t v1 = wasm_v128_load(data + 4U);
+    const v128_t v2 = wasm_v128_load(data + 8U);
+
+    /*  Gather the first three of each component from v0 and v1. The fourth   *
+     *  lane of these shuffles is unused and is overwritten below.            */
+    const v128_t x01 = wasm_i32x4_shuffle(v0, v1, 0, 3, 6, 7);
+    const v128_t y01 = wasm_i32x4_shuffle(v0, v1, 1, 4, 7, 0);
+    const v128_t z01 = wasm_i32x4_shuffle(v0, v1, 2, 5, 0, 0);
+
+    /*  The last of each component comes from v2.                             */
+    *x = wasm_i32x4_shuffle(x01, v2, 0, 1, 2, 5);
+    *y = wasm_i32x4_shuffle(y01, v2, 0, 1, 2, 6);
+    *z = wasm_i32x4_shuffle(z01, v2, 0, 1, 4, 7);
+}
+/*  End of simd_load_xyz4.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      simd_store_xyz4                                                       *
+ *  Purpose:                                                                  *
+ *      Interleaves the x, y, and z components of four points and stores them.*
+ *  Arguments:                                                                *
+ *      data (float * const):                                                 *
+ *          Pointer to where the x component of the first point is written.   *
+ *          Twelve floats are written.                                        *
+ *      x (const v128_t):                                                     *
+ *          The x components of the four points.                              *
+ *      y (const v128_t):                                                     *
+ *          The y components of the four points.                              *
+ *      z (const v128_t):                                                     *
+ *          The z components of the four points.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static inline void
+simd_store_xyz4(float * const data, const v128_t x,
+                const v128_t y, const v128_t z)
+{
+    /*  Pair up the x and y values: (x0, y0, x1, y1) and (x2, y2, x3, y3).    */
+    const v128_t xy01 = wasm_i32x4_shuffle(x, y, 0, 4, 1, 5);
+    const v128_t xy23 = wasm_i32x4_shuffle(x, y, 2, 6, 3, 7);
+
+    /*  The middle vector is (y1, z1, x2, y2), merge y1 and z1 first.         */
+    const v128_t yz1 = wasm_i32x4_shuffle(xy01, z, 3, 5, 0, 0);
+
+    /*  Add the z components and write the twelve floats.                     */
+    wasm_v128_store(data, wasm_i32x4_shuffle(xy01, z, 0, 1, 4, 2));
+    wasm_v128_store(data + 4U, wasm_i32x4_shuffle(yz1, xy23, 0, 1, 4, 5));
+    wasm_v128_store(data + 8U, wasm_i32x4_shuffle(z, xy23, 2, 6, 7, 3));
+}
+/*  End of simd_store_xyz4.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      simd_rotate_xy4                                                       *
+ *  Purpose:                                                                  *
+ *      Rotates four interleaved points about the z axis. The z components are*
+ *      carried over from the input unchanged.                                *
+ *  Arguments:                                                                *
+ *      in (const float * const):                                             *
+ *          Pointer to the first of the four points being rotated.            *
+ *      out (float * const):                                                  *
+ *          Pointer to where the rotated points are written. This may be the  *
+ *          same as the input.                                                *
+ *      cos_angle (const v128_t):                                             *
+ *          The cosine of the angle, splatted across the vector.              *
+ *      sin_angle (const v128_t):                                             *
+ *          The sine of the angle, splatted across the vector.                *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is cheaper than a full load / store, the z values are never split*
+ *      out of their vectors.                                                 *
+ ******************************************************************************/
+static inline void
+simd_rotate_xy4(const float * const in, float * const out,
+                const v128_t cos_angle, const v128_t sin_angle)
+{
+    /*  Load the four points, see simd_load_xyz4 for the layout.              */
+    const v128_t v0 = wasm_v128_load(in);
+    const v128_t v1 = wasm_v128_load(in + 4U);
+    const v128_t v2 = wasm_v128_load(in + 8U);
+
+    /*  Gather the x and y components into their own vectors. The z values    *
+     *  are not changed by the rotation and are left in place.                */
+    const v128_t x01 = wasm_i32x4_shuffle(v0, v1, 0, 3, 6, 7);
+    const v128_t y01 = wasm_i32x4_shuffle(v0, v1, 1, 4, 7, 0);
+    const v128_t x = wasm_i32x4_shuffle(x01, v2, 0, 1, 2, 5);
+    const v128_t y = wasm_i32x4_shuffle(y01, v2, 0, 1, 2, 6);
+
+    /*  Apply the rotation matrix to all four points at once.                 */
+    const v128_t x_rot = wasm_f32x4_sub(
+        wasm_f32x4_mul(cos_angle, x), wasm_f32x4_mul(sin_angle, y)
+    );
+
+    const v128_t y_rot = wasm_f32x4_add(
+        wasm_f32x4_mul(cos_angle, y), wasm_f32x4_mul(sin_angle, x)
+    );
+
+    /*  Interleave the rotated values back into xy pairs.                     */
+    const v128_t xy01 = wasm_i32x4_shuffle(x_rot, y_rot, 0, 4, 1, 5);
+    const v128_t xy23 = wasm_i32x4_shuffle(x_rot, y_rot, 2, 6, 3, 7);
+
+    /*  The middle vector needs the z value from v1, merge this first.        */
+    const v128_t yz1 = wasm_i32x4_shuffle(xy01, v1, 3, 5, 0, 0);
+
+    /*  Put the z components back in place and write the result.              */
+    wasm_v128_store(out, wasm_i32x4_shuffle(xy01, v0, 0, 1, 6, 2));
+    wasm_v128_store(out + 4U, wasm_i32x4_shuffle(yz1, xy23, 0, 1, 4, 5));
+    wasm_v128_store(out + 8U, wasm_i32x4_shuffle(v2, xy23, 0, 6, 7, 3));
+}
+/*  End of simd_rotate_xy4.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      simd_transform_xyz4                                                   *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to four points given by their components.        *
+ *  Arguments:                                                                *
+ *      x (v128_t * const):                                                   *
+ *          The x components of the four points, overwritten by the result.   *
+ *      y (v128_t * const):                                                   *
+ *          The y components of the four points, overwritten by the result.   *
+ *      z (v128_t * const):                                                   *
+ *          The z components of the four points, overwritten by the result.   *
+ *      m (const v128_t * const):                                             *
+ *          The sixteen entries of the matrix, column-major, each splatted    *
+ *          across a vector.                                                  *
+ *      affine (int):                                                         *
+ *          Whether the last row of the matrix is (0, 0, 0, 1). If not, the   *
+ *          points are divided by their w components.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static inline void
+simd_transform_xyz4(v128_t * const x, v128_t * const y, v128_t * const z,
+                    const v128_t * const m, int affine)
+{
+    /*  Each component is a row of the matrix dotted with (x, y, z, 1).       */
+    const v128_t x_out = wasm_f32x4_add(
+        wasm_f32x4_add(wasm_f32x4_mul(m[0], *x), wasm_f32x4_mul(m[4], *y)),
+        wasm_f32x4_add(wasm_f32x4_mul(m[8], *z), m[12])
+    );
+
+    const v128_t y_out = wasm_f32x4_add(
+        wasm_f32x4_add(wasm_f32x4_mul(m[1], *x), wasm_f32x4_mul(m[5], *y)),
+        wasm_f32x4_add(wasm_f32x4_mul(m[9], *z), m[13])
+    );
+
+    const v128_t z_out = wasm_f32x4_add(
+        wasm_f32x4_add(wasm_f32x4_mul(m[2], *x), wasm_f32x4_mul(m[6], *y)),
+        wasm_f32x4_add(wasm_f32x4_mul(m[10], *z), m[14])
+    );
+
+    /*  Affine transforms have w = 1 for every point, skip the division.      */
+    if (affine)
+    {
+        *x = x_out;
+        *y = y_out;
+        *z = z_out;
+    }
+
+    else
+    {
+        const v128_t w = wasm_f32x4_add(
+            wasm_f32x4_add(
+                wasm_f32x4_mul(m[3], *x), wasm_f32x4_mul(m[7], *y)
+            ),
+            wasm_f32x4_add(wasm_f32x4_mul(m[11], *z), m[15])
+        );
+
+        *x = wasm_f32x4_div(x_out, w);
+        *y = wasm_f32x4_div(y_out, w);
+        *z = wasm_f32x4_div(z_out, w);
+    }
+}
+/*  End of simd_transform_xyz4.                                               */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,70 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Swaps the output buffer of a canvas with its back buffer.             *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas typedef found here.                                                */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      swap_output_buffers                                                   *
+ *  Purpose:                                                                  *
+ *      Swaps the output and back buffers, so that the next frame is written  *
+ *      to the buffer that was not rendered last.                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The double buffered canvas.                                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Only the output buffer is written to by update_output_buffer, so this *
+ *      is needed for absolute rotations and planar layouts. Interleaved      *
+ *      meshes rotated in place render the mesh itself, and there is nothing  *
+ *      to swap. Nothing is done for these, nor for canvases without a back   *
+ *      buffer.                                                               *
+ ******************************************************************************/
+void swap_output_buffers(Canvas * const canvas)
+{
+    /*  Variables for swapping the pointers and the capacities. Ownership of  *
+     *  a buffer follows the buffer, so both are swapped.                     */
+    float *buffer;
+    unsigned int capacity;
+
+    /*  If the output aliases the mesh, the mesh would need to be swapped     *
+     *  too. The canvas is not double buffered in this case.                  */
+    if (!canvas->back_output || canvas->output == canvas->mesh)
+        return;
+
+    buffer = canvas->output;
+    canvas->output = canvas->back_output;
+    canvas->back_output = buffer;
+
+    capacity = canvas->output_capacity;
+    canvas->output_capacity = canvas->back_output_capacity;
+    canvas->back_output_capacity = capacity;
+}
+/*  End of swap_output_buffers.                                               */
@@ -25,10 +25,13 @@
 #ifndef THREETOOLS_H
 #define THREETOOLS_H
 
+/*  size_t typedef provided here, used by the allocation routines.            */
+#include <stddef.h>
+
 /*  Typedefs for the animations, provides Canvas, UnitVector, and MeshType.   */
 #include <threetools/types.h>
 
-/*  Globals variables for the animations, including the canvas and buffers.   */
+/*  Globals variables for the animations, including the main canvas.          */
 #include <threetools/globals.h>
 
 /*  Avoid mangling with C++ compilers, check if a C++ compiler is being used. */
@@ -36,6 +39,179 @@
 extern "C" {
 #endif
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      allocate_canvas                                                       *
+ *  Purpose:                                                                  *
+ *      Initializes a canvas from parameters, allocating the buffers.         *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas that is being initialized.                             *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the canvas, passed from JavaScript or Godot.   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If an allocation fails the canvas is emptied, all of its sizes are set*
+ *      to zero.                                                              *
+ ******************************************************************************/
+extern void
+allocate_canvas(Canvas * const canvas,
+                const CanvasParameters * const parameters);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      allocate_canvas_pyramid                                               *
+ *  Purpose:                                                                  *
+ *      Initializes every level of a pyramid from the parameters of the full  *
+ *      grid.                                                                 *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid being initialized.                                    *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for level zero.                                    *
+ *      number_of_levels (unsigned int):                                      *
+ *          The number of levels requested.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each level halves the number of points along both axes, see pyramid.h.*
+ ******************************************************************************/
+extern void
+allocate_canvas_pyramid(CanvasPyramid * const pyramid,
+                        const CanvasParameters * const parameters,
+                        unsigned int number_of_levels);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      allocate_vector_field                                                 *
+ *  Purpose:                                                                  *
+ *      Initializes a vector field grid from parameters, allocating the       *
+ *      instance buffer.                                                      *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid that is being initialized.                               *
+ *      parameters (const VectorFieldParameters * const):                     *
+ *          The parameters for the grid, passed from JavaScript.              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      If the allocation fails the grid is emptied, all of its sizes are set *
+ *      to zero.                                                              *
+ ******************************************************************************/
+extern void
+allocate_vector_field(VectorFieldGrid * const grid,
+                      const VectorFieldParameters * const parameters);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      back_buffer_address                                                   *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the second output buffer, used for double        *
+ *      buffering.                                                            *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the back buffer that we want.               *
+ *  Output:                                                                   *
+ *      back_output (float *):                                                *
+ *          A pointer to the back buffer, NULL if the canvas is not double    *
+ *          buffered.                                                         *
+ ******************************************************************************/
+extern float *back_buffer_address(const Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      canvas_pyramid_level                                                  *
+ *  Purpose:                                                                  *
+ *      Returns the canvas for one level of a pyramid.                        *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid holding the level.                                    *
+ *      level (unsigned int):                                                 *
+ *          The level, zero for the full grid.                                *
+ *  Output:                                                                   *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas for the level, or NULL if there is no such level.      *
+ ******************************************************************************/
+extern Canvas *
+canvas_pyramid_level(CanvasPyramid * const pyramid, unsigned int level);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      check_memory_growth                                                   *
+ *  Purpose:                                                                  *
+ *      Notifies JavaScript if the WebAssembly memory has grown since the last*
+ *      check.                                                                *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void check_memory_growth(void);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      color_buffer_address                                                  *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the color buffer of a canvas.                    *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the colors that we want.                    *
+ *  Output:                                                                   *
+ *      colors (unsigned char *):                                             *
+ *          A pointer to the packed RGB colors, NULL if the canvas is not     *
+ *          colored.                                                          *
+ ******************************************************************************/
+extern unsigned char *color_buffer_address(const Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      color_canvas                                                          *
+ *  Purpose:                                                                  *
+ *      Recomputes the colors of a canvas from the heights of its points.     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, with a color buffer and a color map.                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases without colors or without a color map are left alone.        *
+ ******************************************************************************/
+extern void color_canvas(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      compose_transforms                                                    *
+ *  Purpose:                                                                  *
+ *      Composes two transforms into a single matrix.                         *
+ *  Arguments:                                                                *
+ *      first (const Mat4 * const):                                           *
+ *          The transform that is applied first.                              *
+ *      second (const Mat4 * const):                                          *
+ *          The transform that is applied second.                             *
+ *  Output:                                                                   *
+ *      composition (Mat4):                                                   *
+ *          The matrix product second * first, which applies first and then   *
+ *          second.                                                           *
+ ******************************************************************************/
+extern Mat4
+compose_transforms(const Mat4 * const first, const Mat4 * const second);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      compute_canvas_normals                                                *
+ *  Purpose:                                                                  *
+ *      Computes the unit normals of the output buffer of a canvas.           *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, with a normal buffer from reset_normal_buffer.        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases without a normal buffer are left alone.                      *
+ ******************************************************************************/
+extern void compute_canvas_normals(Canvas * const canvas);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      compute_index_size                                                    *
@@ -49,6 +225,344 @@ extern "C" {
  ******************************************************************************/
 extern void compute_index_size(Canvas * const canvas);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_canvas                                                         *
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new canvas.                               *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the canvas, passed from JavaScript or Godot.   *
+ *  Output:                                                                   *
+ *      canvas (Canvas *):                                                    *
+ *          A pointer to the new canvas, or NULL if the allocation failed.    *
+ *  Notes:                                                                    *
+ *      Free the canvas with destroy_canvas.                                  *
+ ******************************************************************************/
+extern Canvas *create_canvas(const CanvasParameters * const parameters);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_canvas_pyramid                                                 *
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new level-of-detail pyramid of canvases.  *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the full grid.                                 *
+ *      number_of_levels (unsigned int):                                      *
+ *          The number of levels requested.                                   *
+ *  Output:                                                                   *
+ *      pyramid (CanvasPyramid *):                                            *
+ *          A pointer to the new pyramid, or NULL if the allocation failed.   *
+ *  Notes:                                                                    *
+ *      Free the pyramid with destroy_canvas_pyramid.                         *
+ ******************************************************************************/
+extern CanvasPyramid *
+create_canvas_pyramid(const CanvasParameters * const parameters,
+                      unsigned int number_of_levels);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_rainbow_color_map                                              *
+ *  Purpose:                                                                  *
+ *      Creates a rainbow color map, from blue at the minimum to red at the   *
+ *      maximum.                                                              *
+ *  Arguments:                                                                *
+ *      min_value (float):                                                    *
+ *          The value that is colored blue.                                   *
+ *      max_value (float):                                                    *
+ *          The value that is colored red.                                    *
+ *  Output:                                                                   *
+ *      map (ColorMap *):                                                     *
+ *          The color map, NULL if malloc failed. Free with destroy_color_map.*
+ ******************************************************************************/
+extern ColorMap *create_rainbow_color_map(float min_value, float max_value);
+/******************************************************************************
+ *  Function:                                                                 *
+ *      create_vector_field                                                   *
+ *  Purpose:                                                                  *
+ *      Allocates and initializes a new vector field grid.                    *
+ *  Arguments:                                                                *
+ *      parameters (const VectorFieldParameters * const):                     *
+ *          The parameters for the grid, passed from JavaScript.              *
+ *  Output:                                                                   *
+ *      grid (VectorFieldGrid *):                                             *
+ *          A pointer to the new grid, or NULL if the allocation failed.      *
+ *  Notes:                                                                    *
+ *      Free the grid with destroy_vector_field.                              *
+ ******************************************************************************/
+extern VectorFieldGrid *
+create_vector_field(const VectorFieldParameters * const parameters);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_canvas                                                        *
+ *  Purpose:                                                                  *
+ *      Frees a canvas created by create_canvas, and the buffers it owns.     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being destroyed. May be NULL.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void destroy_canvas(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_canvas_pyramid                                                *
+ *  Purpose:                                                                  *
+ *      Frees a pyramid created by create_canvas_pyramid, and its buffers.    *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid being destroyed. May be NULL.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void destroy_canvas_pyramid(CanvasPyramid * const pyramid);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_color_map                                                     *
+ *  Purpose:                                                                  *
+ *      Frees a color map created by create_rainbow_color_map.                *
+ *  Arguments:                                                                *
+ *      map (ColorMap * const):                                               *
+ *          The color map being destroyed.                                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases using the map must be given a new one, or NULL, first.       *
+ ******************************************************************************/
+extern void destroy_color_map(ColorMap * const map);
+/******************************************************************************
+ *  Function:                                                                 *
+ *      destroy_vector_field                                                  *
+ *  Purpose:                                                                  *
+ *      Frees a vector field grid created by create_vector_field, and its     *
+ *      instance buffer.                                                      *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid being destroyed. May be NULL.                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void destroy_vector_field(VectorFieldGrid * const grid);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      finish_canvas_band                                                    *
+ *  Purpose:                                                                  *
+ *      Brings the output, normal, and index buffers of a canvas up to date   *
+ *      after the rows of a band were computed.                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being generated.                                       *
+ *      band (const CanvasBand * const):                                      *
+ *          The band from plan_canvas_band.                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+finish_canvas_band(Canvas * const canvas, const CanvasBand * const band);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      finish_canvas_update                                                  *
+ *  Purpose:                                                                  *
+ *      Brings the output and index buffers of a canvas up to date after the  *
+ *      mesh rows of an update were computed.                                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      update (CanvasUpdate * const):                                        *
+ *          The update from plan_canvas_update. The dirty range of the index  *
+ *          buffer and normals_changed are set here.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+finish_canvas_update(Canvas * const canvas, CanvasUpdate * const update);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      free_canvas                                                           *
+ *  Purpose:                                                                  *
+ *      Frees the buffers allocated by allocate_canvas.                       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose buffers are being freed.                         *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void free_canvas(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      free_canvas_pyramid                                                   *
+ *  Purpose:                                                                  *
+ *      Frees the buffers allocated by allocate_canvas_pyramid.               *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid whose buffers are being freed.                        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void free_canvas_pyramid(CanvasPyramid * const pyramid);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      free_vector_field                                                     *
+ *  Purpose:                                                                  *
+ *      Frees the instance buffer allocated by allocate_vector_field.         *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid whose instance buffer is being freed.                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void free_vector_field(VectorFieldGrid * const grid);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_batched_surface_mesh                                         *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a batched parametrization (u, v) *
+ *      -> (x, y, z).                                                         *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const ParametricSurfaceBatch):                                     *
+ *          The function that defines the surface, evaluated a row at a time. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_batched_surface_mesh(Canvas * const canvas,
+                              const ParametricSurfaceBatch f);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_cached_wireframe                                             *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a canvas, unless the index buffer     *
+ *      already holds them.                                                   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated, zero if it was      *
+ *          reused.                                                           *
+ ******************************************************************************/
+extern unsigned int generate_cached_wireframe(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_wireframe                                             *
+ *  Purpose:                                                                  *
+ *      Creates a wireframe, of the canvas's mesh type, stored in a canvas.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      surface (const SurfaceParametrization):                               *
+ *          The parametrization, a function of the form z = f(x, y).          *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ ******************************************************************************/
+extern unsigned int
+generate_canvas_wireframe(Canvas * const canvas,
+                          const SurfaceParametrization surface);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_band                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the next few rows of a mesh, so a large mesh can be drawn    *
+ *      while it is generated.                                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being generated.                                       *
+ *      f (const SurfaceParametrization):                                     *
+ *          The function z = f(x, y) defining the surface.                    *
+ *      first_row (unsigned int):                                             *
+ *          The first row of the band.                                        *
+ *      rows (unsigned int):                                                  *
+ *          The height of the band, in rows.                                  *
+ *  Output:                                                                   *
+ *      band (CanvasBand):                                                    *
+ *          The rows computed and the ranges that changed.                    *
+ *  Notes:                                                                    *
+ *      Generate the bands in order, starting at row zero.                    *
+ ******************************************************************************/
+extern CanvasBand
+generate_canvas_band(Canvas * const canvas,
+                     const SurfaceParametrization f,
+                     unsigned int first_row,
+                     unsigned int rows);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_fused_wireframe                                              *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe for a surface of the form z = f(x, y),     *
+ *      computing the vertices and line segments of each row together.        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface.                                       *
+ *      f (const SurfaceParametrization):                                     *
+ *          The function z = f(x, y) defining the surface.                    *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ *  Notes:                                                                    *
+ *      Other mesh types fall back to the usual two passes.                   *
+ ******************************************************************************/
+extern unsigned int
+generate_fused_wireframe(Canvas * const canvas, const SurfaceParametrization f);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_glued_square_wireframe                                       *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a grid of squares whose opposite edges*
+ *      may be glued together.                                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      horizontal (EdgeGluing):                                              *
+ *          How the right edge is glued to the left edge.                     *
+ *      vertical (EdgeGluing):                                                *
+ *          How the top edge is glued to the bottom edge.                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_glued_square_wireframe(Canvas * const canvas,
+                                EdgeGluing horizontal,
+                                EdgeGluing vertical);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_glued_triangle_wireframe                                     *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a grid of triangles whose opposite    *
+ *      edges may be glued together.                                          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      horizontal (EdgeGluing):                                              *
+ *          How the right edge is glued to the left edge.                     *
+ *      vertical (EdgeGluing):                                                *
+ *          How the top edge is glued to the bottom edge.                     *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_glued_triangle_wireframe(Canvas * const canvas,
+                                  EdgeGluing horizontal,
+                                  EdgeGluing vertical);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      generate_parametric_mesh                                              *
@@ -65,6 +579,30 @@ extern void compute_index_size(Canvas * const canvas);
 extern void
 generate_parametric_mesh(Canvas * const canvas, const SurfaceParametrization f);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_parametric_mesh_rows                                         *
+ *  Purpose:                                                                  *
+ *      Computes the vertices in a range of rows of a mesh from a parametric  *
+ *      equation.                                                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const SurfaceParametrization):                                     *
+ *          The function that defines the surface, z = f(x, y).               *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is computed.                                   *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is computed.                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_parametric_mesh_rows(Canvas * const canvas,
+                              const SurfaceParametrization f,
+                              unsigned int first_row,
+                              unsigned int end_row);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      generate_rectangular_wireframe                                        *
@@ -79,22 +617,146 @@ generate_parametric_mesh(Canvas * const canvas, const SurfaceParametrization f);
  ******************************************************************************/
 extern void generate_rectangular_wireframe(Canvas * const canvas);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_separable_surface_mesh                                       *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a separable surface, with the    *
+ *      trig values of each axis computed once.                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const SeparableSurface):                                           *
+ *          The function that defines the surface, in terms of the samples of *
+ *          u and v.                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_separable_surface_mesh(Canvas * const canvas,
+                                const SeparableSurface f);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_surface_mesh                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a parametrization (u, v) -> (x,  *
+ *      y, z).                                                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const ParametricSurface):                                          *
+ *          The function that defines the surface.                            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_surface_mesh(Canvas * const canvas, const ParametricSurface f);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_tube_mesh                                                    *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a tube of constant radius around a curve.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      curve (const ParametricCurve):                                        *
+ *          The curve at the center of the tube.                              *
+ *      radius (float):                                                       *
+ *          The radius of the tube.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+generate_tube_mesh(Canvas * const canvas,
+                   const ParametricCurve curve,
+                   float radius);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_wireframe                                                    *
+ *  Purpose:                                                                  *
+ *      Generates the line segments for a canvas, using its mesh type.        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void generate_wireframe(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      get_kernel_counter                                                    *
+ *  Purpose:                                                                  *
+ *      Returns the number of calls, points processed, and total time for a   *
+ *      kernel.                                                               *
+ *  Arguments:                                                                *
+ *      kernel (ProfileKernel):                                               *
+ *          The kernel whose counters are wanted.                             *
+ *  Output:                                                                   *
+ *      counter (KernelCounter):                                              *
+ *          The counters since the last call to reset_kernel_counters.        *
+ *  Notes:                                                                    *
+ *      The counters are always zero unless the library is built with         *
+ *      THREETOOLS_PROFILE.                                                   *
+ ******************************************************************************/
+extern KernelCounter get_kernel_counter(ProfileKernel kernel);
+/******************************************************************************
+ *  Function:                                                                 *
+ *      homotopy_canvas                                                       *
+ *  Purpose:                                                                  *
+ *      Computes the straight-line homotopy (1 - t) f + t g between the mesh  *
+ *      of one canvas and the mesh of another, and writes it to the output    *
+ *      buffer.                                                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the start mesh, f. This is the canvas that is     *
+ *          rendered.                                                         *
+ *      target (const Canvas * const):                                        *
+ *          The canvas with the end mesh, g.                                  *
+ *      t (float):                                                            *
+ *          The time parameter, usually between 0 and 1.                      *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+homotopy_canvas(Canvas * const canvas, const Canvas * const target, float t);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      index_buffer_address                                                  *
  *  Purpose:                                                                  *
- *      Returns a pointer to the index array.                                 *
+ *      Returns a pointer to the index array.                                 *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const).                                        *
+ *          The canvas containing the index buffer that we want.              *
+ *  Output:                                                                   *
+ *      address (void *):                                                     *
+ *          A pointer to the index array.                                     *
+ *  Notes:                                                                    *
+ *      This function is called at the JavaScript level to get the address    *
+ *      for the index array so it may read and write to it.                   *
+ ******************************************************************************/
+extern void *index_buffer_address(const Canvas * const);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      index_buffer_type                                                     *
+ *  Purpose:                                                                  *
+ *      Returns the element type of the index buffer.                         *
  *  Arguments:                                                                *
- *      canvas (const Canvas * const).                                        *
- *          The canvas containing the index buffer that we want.              *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the index buffer.                           *
  *  Output:                                                                   *
- *      address (unsigned int *):                                             *
- *          A pointer to the index array.                                     *
+ *      type (IndexType):                                                     *
+ *          Uint16Indices or Uint32Indices.                                   *
  *  Notes:                                                                    *
- *      This function is called at the JavaScript level to get the address    *
- *      for the index array so it may read and write to it.                   *
+ *      This function is used at the JavaScript level to choose the view type *
+ *      for the index array.                                                  *
  ******************************************************************************/
-extern unsigned int *index_buffer_address(const Canvas * const);
+extern IndexType index_buffer_type(const Canvas * const canvas);
 
 /******************************************************************************
  *  Function:                                                                 *
@@ -109,6 +771,19 @@ extern unsigned int *index_buffer_address(const Canvas * const);
  ******************************************************************************/
 extern void init_main_canvas(const CanvasParameters * const parameters);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      invalidate_index_topology                                             *
+ *  Purpose:                                                                  *
+ *      Forgets the topology the index buffer was generated for.              *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose index buffer no longer holds a valid wireframe.  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void invalidate_index_topology(Canvas * const canvas);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      main_canvas_address                                                   *
@@ -124,6 +799,24 @@ extern void init_main_canvas(const CanvasParameters * const parameters);
  ******************************************************************************/
 extern Canvas *main_canvas_address(void);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      make_rainbow_color_map                                                *
+ *  Purpose:                                                                  *
+ *      Fills in a rainbow color map, from blue at the minimum to red at the  *
+ *      maximum.                                                              *
+ *  Arguments:                                                                *
+ *      map (ColorMap * const):                                               *
+ *          The color map being written to.                                   *
+ *      min_value (float):                                                    *
+ *          The value that is colored blue.                                   *
+ *      max_value (float):                                                    *
+ *          The value that is colored red.                                    *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+make_rainbow_color_map(ColorMap * const map, float min_value, float max_value);
 /******************************************************************************
  *  Function:                                                                 *
  *      make_rectangular_wireframe                                            *
@@ -135,12 +828,30 @@ extern Canvas *main_canvas_address(void);
  *      surface (const SurfaceParametrization):                               *
  *          The parametrization, a function of the form z = f(x, y).          *
  *  Output:                                                                   *
- *      None (void).                                                          *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
  ******************************************************************************/
-extern void
+extern unsigned int
 make_rectangular_wireframe(const CanvasParameters * const parameters,
                            const SurfaceParametrization surface);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      match_canvas_rotation                                                 *
+ *  Purpose:                                                                  *
+ *      Rotates a canvas about the z axis to the angle of another canvas.     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being rotated.                                         *
+ *      reference (const Canvas * const):                                     *
+ *          The canvas whose angle is copied.                                 *
+ *  Output:                                                                   *
+ *      rotated (unsigned int):                                               *
+ *          Non-zero if the canvas was rotated.                               *
+ ******************************************************************************/
+extern unsigned int
+match_canvas_rotation(Canvas * const canvas, const Canvas * const reference);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      mesh_buffer_address                                                   *
@@ -158,6 +869,168 @@ make_rectangular_wireframe(const CanvasParameters * const parameters,
  ******************************************************************************/
 extern float *mesh_buffer_address(const Canvas * const canvas);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      normal_buffer_address                                                 *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the interleaved normals of a canvas.             *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the normal buffer that we want.             *
+ *  Output:                                                                   *
+ *      normals (float *):                                                    *
+ *          A pointer to the normal buffer, NULL if the canvas has no normals.*
+ ******************************************************************************/
+extern float *normal_buffer_address(const Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      output_buffer_address                                                 *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the interleaved output array.                    *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas containing the output buffer that we want.             *
+ *  Output:                                                                   *
+ *      output (float *):                                                     *
+ *          A pointer to the output array.                                    *
+ *  Notes:                                                                    *
+ *      This function is called at the JavaScript level to get the address for*
+ *      the array that three.js renders from. For interleaved meshes this is  *
+ *      the same as mesh_buffer_address.                                      *
+ ******************************************************************************/
+extern float *output_buffer_address(const Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      pack_planar_mesh                                                      *
+ *  Purpose:                                                                  *
+ *      Copies the x, y, and z planes of a planar mesh into the interleaved   *
+ *      output buffer, which is the format three.js expects.                  *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the planar mesh and the output buffer.            *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Interleaved meshes are rendered directly, nothing is done for these.  *
+ ******************************************************************************/
+extern void pack_planar_mesh(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parallel_rows                                                         *
+ *  Purpose:                                                                  *
+ *      Runs a row kernel over a range of rows of a canvas, in parallel if    *
+ *      possible.                                                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being processed.                                       *
+ *      kernel (RowKernel):                                                   *
+ *          The kernel for a band of rows.                                    *
+ *      data (const void * const):                                            *
+ *          Extra data passed to the kernel.                                  *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Only builds with THREETOOLS_USE_PTHREADS use threads. The number of   *
+ *      threads is set with set_thread_count.                                 *
+ ******************************************************************************/
+extern void
+parallel_rows(Canvas * const canvas,
+              RowKernel kernel,
+              const void * const data,
+              unsigned int first_row,
+              unsigned int end_row);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      plan_canvas_band                                                      *
+ *  Purpose:                                                                  *
+ *      Finds the rows and the buffer ranges for the next band of a mesh that *
+ *      is generated a few rows at a time.                                    *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas being generated.                                       *
+ *      first_row (unsigned int):                                             *
+ *          The first row of the band.                                        *
+ *      rows (unsigned int):                                                  *
+ *          The height of the band, in rows.                                  *
+ *  Output:                                                                   *
+ *      band (CanvasBand):                                                    *
+ *          The rows of the band, clamped to the grid, and its ranges.        *
+ ******************************************************************************/
+extern CanvasBand
+plan_canvas_band(const Canvas * const canvas,
+                 unsigned int first_row,
+                 unsigned int rows);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      plan_canvas_update                                                    *
+ *  Purpose:                                                                  *
+ *      Resizes a canvas for new parameters, finding the rows of the mesh that*
+ *      are still valid.                                                      *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *  Output:                                                                   *
+ *      update (CanvasUpdate):                                                *
+ *          The rows that must be recomputed, starting at update.first_row,   *
+ *          and the dirty range of the output buffer.                         *
+ ******************************************************************************/
+extern CanvasUpdate
+plan_canvas_update(Canvas * const canvas,
+                   const CanvasParameters * const parameters);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      profiling_enabled                                                     *
+ *  Purpose:                                                                  *
+ *      Checks if the library was built with THREETOOLS_PROFILE.              *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      enabled (unsigned int):                                               *
+ *          One if the kernels are timed, zero otherwise.                     *
+ ******************************************************************************/
+extern unsigned int profiling_enabled(void);
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_back_buffer                                                     *
+ *  Purpose:                                                                  *
+ *      Resets the second output buffer, making the canvas double buffered.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose back buffer is being reset.                      *
+ *      buffer (float *):                                                     *
+ *          The buffer where the canvas stores the other frame. If NULL, the  *
+ *          canvas allocates its own buffer.                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void reset_back_buffer(Canvas *canvas, float *buffer);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_color_buffer                                                    *
+ *  Purpose:                                                                  *
+ *      Sets the color buffer of a canvas, or allocates one.                  *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose color buffer is being set.                       *
+ *      buffer (unsigned char *):                                             *
+ *          The new buffer, or NULL to have the canvas allocate one.          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void reset_color_buffer(Canvas *canvas, unsigned char *buffer);
 /******************************************************************************
  *  Function:                                                                 *
  *      reset_index_buffer                                                    *
@@ -166,13 +1039,25 @@ extern float *mesh_buffer_address(const Canvas * const canvas);
  *  Arguments:                                                                *
  *      canvas (Canvas *):                                                    *
  *          The canvas that is being resized.                                 *
- *      buffer (unsigned int *):                                              *
- *          The buffer where the canvas will store its data.                  *
+ *      buffer (void *):                                                      *
+ *          The buffer where the canvas will store its data. If NULL, the     *
+ *          canvas allocates its own buffer.                                  *
  *  Output:                                                                   *
  *      None (void).                                                          *
  ******************************************************************************/
-extern void reset_index_buffer(Canvas *canvas, unsigned int *buffer);
+extern void reset_index_buffer(Canvas *canvas, void *buffer);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_kernel_counters                                                 *
+ *  Purpose:                                                                  *
+ *      Sets the counters of every kernel back to zero.                       *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void reset_kernel_counters(void);
 /******************************************************************************
  *  Function:                                                                 *
  *      reset_mesh_buffer                                                     *
@@ -182,12 +1067,95 @@ extern void reset_index_buffer(Canvas *canvas, unsigned int *buffer);
  *      canvas (Canvas *):                                                    *
  *          The canvas that is being resized.                                 *
  *      buffer (float *):                                                     *
- *          The buffer where the canvas will store its data.                  *
+ *          The buffer where the canvas will store its data. If NULL, the     *
+ *          canvas allocates its own buffer.                                  *
  *  Output:                                                                   *
  *      None (void).                                                          *
  ******************************************************************************/
 extern void reset_mesh_buffer(Canvas *canvas, float *buffer);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_normal_buffer                                                   *
+ *  Purpose:                                                                  *
+ *      Resets the normal buffer, giving the canvas per-vertex normals.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose normal buffer is being reset.                    *
+ *      buffer (float *):                                                     *
+ *          The buffer where the canvas stores its normals. If NULL, the      *
+ *          canvas allocates its own buffer.                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void reset_normal_buffer(Canvas *canvas, float *buffer);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      reset_output_buffer                                                   *
+ *  Purpose:                                                                  *
+ *      Resets the buffer the canvas is rendered from.                        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas *):                                                    *
+ *          The canvas whose output buffer is being reset.                    *
+ *      buffer (float *):                                                     *
+ *          The buffer where the canvas will store its interleaved vertices.  *
+ *          For interleaved meshes this is the mesh buffer itself. If NULL,   *
+ *          the canvas allocates its own buffer.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void reset_output_buffer(Canvas *canvas, float *buffer);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      resize_buffer                                                         *
+ *  Purpose:                                                                  *
+ *      Ensures a buffer owned by a canvas has room for a given number of     *
+ *      elements.                                                             *
+ *  Arguments:                                                                *
+ *      buffer (void *):                                                      *
+ *          The current buffer. Freed only if capacity is non-zero.           *
+ *      capacity (unsigned int * const):                                      *
+ *          The size of the buffer in bytes, zero if it is not owned. Updated *
+ *          with the new capacity.                                            *
+ *      size (unsigned int):                                                  *
+ *          The number of elements that are needed.                           *
+ *      element_size (size_t):                                                *
+ *          The size, in bytes, of a single element.                          *
+ *  Output:                                                                   *
+ *      new_buffer (void *):                                                  *
+ *          A buffer with room for size elements, or NULL on failure.         *
+ *  Notes:                                                                    *
+ *      The contents of the buffer are not preserved when it grows. Sizes     *
+ *      whose byte count overflows an unsigned int fail, returning NULL.      *
+ ******************************************************************************/
+extern void *
+resize_buffer(void *buffer,
+              unsigned int * const capacity,
+              unsigned int size,
+              size_t element_size);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_interleaved_buffer                                             *
+ *  Purpose:                                                                  *
+ *      Rotates an interleaved buffer of points, or vectors, about the z axis.*
+ *  Arguments:                                                                *
+ *      buffer (float * const):                                               *
+ *          The points, (x0, y0, z0, x1, y1, z1, ...), rotated in place.      *
+ *      number_of_points (unsigned int):                                      *
+ *          The number of points in the buffer.                               *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+rotate_interleaved_buffer(float * const buffer,
+                          unsigned int number_of_points,
+                          UnitVector point);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      rotate_mesh                                                           *
@@ -203,6 +1171,67 @@ extern void reset_mesh_buffer(Canvas *canvas, float *buffer);
  ******************************************************************************/
 extern void rotate_mesh(Canvas *canvas, UnitVector point);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotate_mesh_to_output                                                 *
+ *  Purpose:                                                                  *
+ *      Writes the mesh of a canvas, rotated by the provided unit vector, into*
+ *      the output buffer. The mesh itself is not modified.                   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being rotated.                   *
+ *      point (UnitVector):                                                   *
+ *          A point on the unit circle, its polar angle is used for rotating. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The output buffer must be different from the mesh buffer.             *
+ ******************************************************************************/
+extern void rotate_mesh_to_output(Canvas * const canvas, UnitVector point);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      sample_vector_field                                                   *
+ *  Purpose:                                                                  *
+ *      Evaluates a vector field at every point of a grid, writing the arrows *
+ *      to the instance buffer.                                               *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid, from allocate_vector_field or create_vector_field.      *
+ *      f (const VectorField):                                                *
+ *          The vector field being sampled.                                   *
+ *      time (float):                                                         *
+ *          The time the field is evaluated at, for animated fields.          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each arrow is VECTOR_FIELD_INSTANCE_SIZE floats, the position, the    *
+ *      unit direction, and the magnitude. Zero vectors have zero direction   *
+ *      and magnitude.                                                        *
+ ******************************************************************************/
+extern void
+sample_vector_field(VectorFieldGrid * const grid,
+                    const VectorField f,
+                    float time);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      set_canvas_color_map                                                  *
+ *  Purpose:                                                                  *
+ *      Sets the color map of a canvas and colors its points.                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being colored.                                         *
+ *      map (const ColorMap * const):                                         *
+ *          The color map, or NULL to stop coloring the canvas.               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      A color buffer is allocated if the canvas does not have one. The map  *
+ *      is not copied, it must outlive its use by the canvas.                 *
+ ******************************************************************************/
+extern void
+set_canvas_color_map(Canvas * const canvas, const ColorMap * const map);
 /******************************************************************************
  *  Function:                                                                 *
  *      set_rotation_angle                                                    *
@@ -216,6 +1245,121 @@ extern void rotate_mesh(Canvas *canvas, UnitVector point);
  ******************************************************************************/
 extern void set_rotation_angle(float angle);
 
+/******************************************************************************
+ *  Function:                                                                 *
+ *      set_thread_count                                                      *
+ *  Purpose:                                                                  *
+ *      Sets the number of threads used for generating meshes.                *
+ *  Arguments:                                                                *
+ *      count (unsigned int):                                                 *
+ *          The number of threads, clamped to between one and                 *
+ *          MAX_THREAD_COUNT.                                                 *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void set_thread_count(unsigned int count);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      swap_output_buffers                                                   *
+ *  Purpose:                                                                  *
+ *      Swaps the output and back buffers, so that the next frame is written  *
+ *      to the buffer that was not rendered last.                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The double buffered canvas.                                       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void swap_output_buffers(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_canvas                                                      *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to the mesh of a canvas, and brings the output   *
+ *      buffer and normals up to date.                                        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      matrix (const Mat4 * const):                                          *
+ *          The transform, with column-major entries like a three.js Matrix4. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+transform_canvas(Canvas * const canvas, const Mat4 * const matrix);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_mesh                                                        *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to every point in the mesh of a canvas.          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being transformed.               *
+ *      matrix (const Mat4 * const):                                          *
+ *          The transform, with column-major entries like a three.js Matrix4. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+extern void
+transform_mesh(Canvas * const canvas, const Mat4 * const matrix);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      update_canvas                                                         *
+ *  Purpose:                                                                  *
+ *      Updates a canvas for new parameters, recomputing only what changed.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *      f (const SurfaceParametrization):                                     *
+ *          The function that defines the surface, z = f(x, y).               *
+ *  Output:                                                                   *
+ *      update (CanvasUpdate):                                                *
+ *          The dirty ranges of the output and index buffers.                 *
+ ******************************************************************************/
+extern CanvasUpdate
+update_canvas(Canvas * const canvas,
+              const CanvasParameters * const parameters,
+              const SurfaceParametrization f);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      update_output_buffer                                                  *
+ *  Purpose:                                                                  *
+ *      Recomputes the output buffer, which is what is rendered, from the     *
+ *      mesh.                                                                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose output buffer is being updated.                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      For absolute rotations the mesh is rotated by the total angle of the  *
+ *      canvas. Otherwise planar meshes are packed, and interleaved meshes are*
+ *      rendered directly and nothing is done.                                *
+ ******************************************************************************/
+extern void update_output_buffer(Canvas * const canvas);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      vector_field_instances_address                                        *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the instance buffer of a vector field grid.      *
+ *  Arguments:                                                                *
+ *      grid (const VectorFieldGrid * const):                                 *
+ *          The grid containing the instance buffer that we want.             *
+ *  Output:                                                                   *
+ *      instances (float *):                                                  *
+ *          A pointer to the instance buffer.                                 *
+ ******************************************************************************/
+extern float *
+vector_field_instances_address(const VectorFieldGrid * const grid);
+
 /******************************************************************************
  *  Function:                                                                 *
  *      z_rotate_canvas                                                       *
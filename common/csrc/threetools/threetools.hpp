@@ -0,0 +1,732 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Header-only C++ front end for the mesh generators. The surface is a   *
+ *      template parameter, so it may be inlined into the loops.              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_HPP
+#define THREETOOLS_HPP
+
+/*  The C API, which these templates wrap, is found here.                     */
+#include <threetools/threetools.h>
+
+/*  write_color, used for coloring the points by a scalar field.              */
+#include <threetools/color_map.h>
+
+/*  The loops over the rows of a mesh, shared with the C functions.           */
+#include <threetools/rows.h>
+
+/*  The row kernels for z = f(x, y) are run by the helpers found here.        */
+#include <threetools/parametric.h>
+
+/*  pyramid_level_parameters, used for the levels of a CanvasPyramid.         */
+#include <threetools/pyramid.h>
+
+/*  store_tube_rows, used for tubes around curves.                            */
+#include <threetools/tube.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernels, provided here.    */
+#include <threetools/profile.h>
+
+/*  sample_field_grid, used for sampling vector fields.                       */
+#include <threetools/vector_field.h>
+
+/*  The function pointer API, found in threetools.h, is kept for the Go and   *
+ *  Rust parity ports. Even with -flto the call through the pointer is often  *
+ *  not inlined across the boundary of libthreetools.a, so C++ animations     *
+ *  should prefer the templates here. Lambdas have unique types, giving one   *
+ *  specialization per surface. The loops are the ones the C functions use,   *
+ *  see rows.h and parametric.h, only the evaluation of the surface differs.  */
+namespace threetools {
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_height                                                       *
+ *  Purpose:                                                                  *
+ *      Evaluates a surface z = f(x, y) given as a functor.                   *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      x (float):                                                            *
+ *          The x coordinate of the point.                                    *
+ *      y (float):                                                            *
+ *          The y coordinate of the point.                                    *
+ *  Output:                                                                   *
+ *      z (float):                                                            *
+ *          The height of the surface at (x, y).                              *
+ *  Notes:                                                                    *
+ *      This is the HeightEvaluator of the templates. Its address is a        *
+ *      constant in each kernel, so it is inlined into the loops of rows.h.   *
+ ******************************************************************************/
+template <typename F>
+inline float evaluate_height(const void * const data, float x, float y)
+{
+    return (*static_cast<const F *>(data))(x, y);
+}
+/*  End of evaluate_height.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_point                                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates a surface (u, v) -> (x, y, z) given as a functor.           *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      u (float):                                                            *
+ *          The horizontal parameter.                                         *
+ *      v (float):                                                            *
+ *          The vertical parameter.                                           *
+ *  Output:                                                                   *
+ *      point (Vec3):                                                         *
+ *          The point of the surface at (u, v).                               *
+ ******************************************************************************/
+template <typename F>
+inline Vec3 evaluate_point(const void * const data, float u, float v)
+{
+    return (*static_cast<const F *>(data))(u, v);
+}
+/*  End of evaluate_point.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_separable                                                    *
+ *  Purpose:                                                                  *
+ *      Evaluates a separable surface given as a functor.                     *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      u (const AxisSample * const):                                         *
+ *          The sample of the horizontal parameter.                           *
+ *      v (const AxisSample * const):                                         *
+ *          The sample of the vertical parameter.                             *
+ *  Output:                                                                   *
+ *      point (Vec3):                                                         *
+ *          The point of the surface at (u, v).                               *
+ ******************************************************************************/
+template <typename F>
+inline Vec3
+evaluate_separable(const void * const data,
+                   const AxisSample * const u,
+                   const AxisSample * const v)
+{
+    return (*static_cast<const F *>(data))(*u, *v);
+}
+/*  End of evaluate_separable.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_field                                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates a vector field given as a functor.                          *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the field.                        *
+ *      position (Vec3):                                                      *
+ *          The point the field is evaluated at.                              *
+ *      time (float):                                                         *
+ *          The time the field is evaluated at.                               *
+ *  Output:                                                                   *
+ *      field (Vec3):                                                         *
+ *          The value of the field.                                           *
+ ******************************************************************************/
+template <typename F>
+inline Vec3 evaluate_field(const void * const data, Vec3 position, float time)
+{
+    return (*static_cast<const F *>(data))(position, time);
+}
+/*  End of evaluate_field.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parametric_rows                                                       *
+ *  Purpose:                                                                  *
+ *      Row kernel for generate_parametric_mesh, processes a band of rows.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+parametric_rows(Canvas * const canvas,
+                const void * const data,
+                unsigned int first_row,
+                unsigned int end_row)
+{
+    store_parametric_rows(
+        canvas, evaluate_height<F>, data, first_row, end_row, NULL
+    );
+}
+/*  End of parametric_rows.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      colored_parametric_rows                                               *
+ *  Purpose:                                                                  *
+ *      Row kernel for generate_parametric_mesh on canvases with a color map, *
+ *      processes a band of rows.                                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation, with a color buffer and a color map.*
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+colored_parametric_rows(Canvas * const canvas,
+                        const void * const data,
+                        unsigned int first_row,
+                        unsigned int end_row)
+{
+    store_parametric_rows(
+        canvas, evaluate_height<F>, data, first_row, end_row,
+        parametric_colors(canvas, first_row)
+    );
+}
+/*  End of colored_parametric_rows.                                           */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      fused_rows                                                            *
+ *  Purpose:                                                                  *
+ *      Row kernel for generate_fused_wireframe, computes the vertices of a   *
+ *      band of rows and writes the line segments of each row right after its *
+ *      vertices.                                                             *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+fused_rows(Canvas * const canvas,
+           const void * const data,
+           unsigned int first_row,
+           unsigned int end_row)
+{
+    store_fused_rows(canvas, evaluate_height<F>, data, first_row, end_row);
+}
+/*  End of fused_rows.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parametric_kernels                                                    *
+ *  Purpose:                                                                  *
+ *      Gives the row kernels for a surface z = f(x, y) given as a functor.   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      kernels (ParametricKernels):                                          *
+ *          The kernels, each expecting a pointer to the functor.             *
+ ******************************************************************************/
+template <typename F>
+inline ParametricKernels parametric_kernels()
+{
+    ParametricKernels kernels;
+    kernels.plain = parametric_rows<F>;
+    kernels.colored = colored_parametric_rows<F>;
+    kernels.fused = fused_rows<F>;
+    return kernels;
+}
+/*  End of parametric_kernels.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_parametric_mesh                                              *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a surface of the form z = f(x,   *
+ *      y).                                                                   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void generate_parametric_mesh(Canvas * const canvas, const F& f)
+{
+    const ParametricKernels kernels = parametric_kernels<F>();
+    run_parametric_rows(canvas, &kernels, &f, 0U, canvas->ny_pts);
+}
+/*  End of generate_parametric_mesh.                                          */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      surface_rows                                                          *
+ *  Purpose:                                                                  *
+ *      Row kernel for generate_surface_mesh, processes a band of rows.       *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+surface_rows(Canvas * const canvas,
+             const void * const data,
+             unsigned int first_row,
+             unsigned int end_row)
+{
+    store_surface_rows(canvas, evaluate_point<F>, data, first_row, end_row);
+}
+/*  End of surface_rows.                                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_surface_mesh                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a surface (u, v) -> (x, y, z).   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature Vec3(float u, float v).        *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Glued axes are sampled periodically.                                  *
+ ******************************************************************************/
+template <typename F>
+inline void generate_surface_mesh(Canvas * const canvas, const F& f)
+{
+    PROFILE_START;
+    parallel_rows(canvas, surface_rows<F>, &f, 0U, canvas->ny_pts);
+    PROFILE_STOP(SurfaceMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_surface_mesh.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      separable_surface_rows                                                *
+ *  Purpose:                                                                  *
+ *      Row kernel for generate_separable_surface_mesh, processes a band of   *
+ *      rows.                                                                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the surface.                      *
+ *      first_row (unsigned int):                                             *
+ *          The first row that is processed.                                  *
+ *      end_row (unsigned int):                                               *
+ *          One past the last row that is processed.                          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+separable_surface_rows(Canvas * const canvas,
+                       const void * const data,
+                       unsigned int first_row,
+                       unsigned int end_row)
+{
+    store_separable_rows(
+        canvas, evaluate_separable<F>, data, first_row, end_row
+    );
+}
+/*  End of separable_surface_rows.                                            */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_separable_surface_mesh                                       *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a mesh from a separable surface, with the    *
+ *      trig values of each axis computed once.                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature Vec3(const AxisSample& u, const*
+ *          AxisSample& v).                                                   *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The surface is inlined into the loop, so there is no call per point   *
+ *      either.                                                               *
+ ******************************************************************************/
+template <typename F>
+inline void generate_separable_surface_mesh(Canvas * const canvas, const F& f)
+{
+    PROFILE_START;
+    parallel_rows(canvas, separable_surface_rows<F>, &f, 0U, canvas->ny_pts);
+    PROFILE_STOP(SurfaceMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_separable_surface_mesh.                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      evaluate_curve                                                        *
+ *  Purpose:                                                                  *
+ *      Evaluates a curve given as a functor.                                 *
+ *  Arguments:                                                                *
+ *      data (const void * const):                                            *
+ *          Pointer to the functor defining the curve.                        *
+ *      t (float):                                                            *
+ *          The parameter of the point.                                       *
+ *  Output:                                                                   *
+ *      point (Vec3):                                                         *
+ *          The point of the curve at t.                                      *
+ ******************************************************************************/
+template <typename F>
+inline Vec3 evaluate_curve(const void * const data, float t)
+{
+    return (*static_cast<const F *>(data))(t);
+}
+/*  End of evaluate_curve.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_tube_mesh                                                    *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a tube of constant radius around a curve.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      curve (const F&):                                                     *
+ *          A functor or lambda with signature Vec3(float t).                 *
+ *      radius (float):                                                       *
+ *          The radius of the tube.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+generate_tube_mesh(Canvas * const canvas, const F& curve, float radius)
+{
+    PROFILE_START;
+    store_tube_rows(canvas, evaluate_curve<F>, &curve, radius);
+    PROFILE_STOP(TubeMeshKernel, canvas->number_of_points);
+}
+/*  End of generate_tube_mesh.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      color_canvas                                                          *
+ *  Purpose:                                                                  *
+ *      Recomputes the colors of a canvas from a scalar field.                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, with a color buffer and a color map.                  *
+ *      g (const G&):                                                         *
+ *          A functor or lambda with signature float(Vec3 point), the value   *
+ *          that is colored.                                                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The C version of color_canvas colors by height. This colors by any    *
+ *      function of the points in the output buffer, like the distance from   *
+ *      the origin. Canvases without colors or without a color map are left   *
+ *      alone.                                                                *
+ ******************************************************************************/
+template <typename G>
+inline void color_canvas(Canvas * const canvas, const G& g)
+{
+    if (!canvas->colors || !canvas->color_map)
+        return;
+
+    PROFILE_START;
+
+    for (unsigned int index = 0U; index < canvas->number_of_points; ++index)
+    {
+        const float * const point = canvas->output + 3U * index;
+        const Vec3 p = {point[0], point[1], point[2]};
+        write_color(canvas->color_map, g(p), canvas->colors + 3U * index);
+    }
+
+    PROFILE_STOP(ColorsKernel, canvas->number_of_points);
+}
+/*  End of color_canvas.                                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_wireframe                                             *
+ *  Purpose:                                                                  *
+ *      Creates a wireframe, of the canvas's mesh type, for a surface of the  *
+ *      form z = f(x, y).                                                     *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ ******************************************************************************/
+template <typename F>
+inline unsigned int generate_canvas_wireframe(Canvas * const canvas, const F& f)
+{
+    const ParametricKernels kernels = parametric_kernels<F>();
+    return run_canvas_wireframe(canvas, &kernels, &f);
+}
+/*  End of generate_canvas_wireframe.                                         */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_fused_wireframe                                              *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe for a surface of the form z = f(x, y),     *
+ *      computing the vertices and line segments of each row together.        *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the surface, from allocate_canvas or create_canvas.*
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ *  Notes:                                                                    *
+ *      This gives the same buffers as generate_canvas_wireframe, see         *
+ *      run_fused_wireframe.                                                  *
+ ******************************************************************************/
+template <typename F>
+inline unsigned int generate_fused_wireframe(Canvas * const canvas, const F& f)
+{
+    const ParametricKernels kernels = parametric_kernels<F>();
+    return run_fused_wireframe(canvas, &kernels, &f);
+}
+/*  End of generate_fused_wireframe.                                          */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      make_rectangular_wireframe                                            *
+ *  Purpose:                                                                  *
+ *      Creates a rectangular wireframe stored in the main_canvas.            *
+ *  Arguments:                                                                *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The parameters for the main canvas.                               *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer was regenerated.                     *
+ *  Notes:                                                                    *
+ *      Square wireframes are computed in one pass, see                       *
+ *      generate_fused_wireframe.                                             *
+ ******************************************************************************/
+template <typename F>
+inline unsigned int
+make_rectangular_wireframe(const CanvasParameters * const parameters,
+                           const F& f)
+{
+    init_main_canvas(parameters);
+    return generate_fused_wireframe(&main_canvas, f);
+}
+/*  End of make_rectangular_wireframe.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      update_canvas                                                         *
+ *  Purpose:                                                                  *
+ *      Updates a canvas for new parameters, recomputing only what changed.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      update (CanvasUpdate):                                                *
+ *          The dirty ranges of the output and index buffers.                 *
+ ******************************************************************************/
+template <typename F>
+inline CanvasUpdate
+update_canvas(Canvas * const canvas,
+              const CanvasParameters * const parameters,
+              const F& f)
+{
+    const ParametricKernels kernels = parametric_kernels<F>();
+    return run_canvas_update(canvas, parameters, &kernels, &f);
+}
+/*  End of update_canvas.                                                     */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_band                                                  *
+ *  Purpose:                                                                  *
+ *      Computes the next few rows of a mesh for a surface of the form z =    *
+ *      f(x, y), so that a large mesh can be drawn while it is still being    *
+ *      generated.                                                            *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being generated.                                       *
+ *      first_row (unsigned int):                                             *
+ *          The first row of the band, zero for the first band.               *
+ *      rows (unsigned int):                                                  *
+ *          The height of the band, in rows.                                  *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      band (CanvasBand):                                                    *
+ *          The rows that were computed and the ranges of the output and index*
+ *          buffers that changed or became drawable.                          *
+ ******************************************************************************/
+template <typename F>
+inline CanvasBand
+generate_canvas_band(Canvas * const canvas,
+                     unsigned int first_row,
+                     unsigned int rows,
+                     const F& f)
+{
+    const ParametricKernels kernels = parametric_kernels<F>();
+    return run_canvas_band(canvas, &kernels, &f, first_row, rows);
+}
+/*  End of generate_canvas_band.                                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generate_canvas_pyramid                                               *
+ *  Purpose:                                                                  *
+ *      Creates the wireframes for every level of a level-of-detail pyramid,  *
+ *      for a surface of the form z = f(x, y).                                *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid for the surface, from create_canvas_pyramid.          *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      changed (unsigned int):                                               *
+ *          Non-zero if the index buffer of any level was regenerated.        *
+ *  Notes:                                                                    *
+ *      Each level caches its own index topology, so calling this again for a *
+ *      new surface or domain only recomputes the vertices.                   *
+ ******************************************************************************/
+template <typename F>
+inline unsigned int
+generate_canvas_pyramid(CanvasPyramid * const pyramid, const F& f)
+{
+    unsigned int changed = 0U;
+
+    for (unsigned int level = 0U; level < pyramid->number_of_levels; ++level)
+        changed |= generate_canvas_wireframe(&pyramid->levels[level], f);
+
+    return changed;
+}
+/*  End of generate_canvas_pyramid.                                           */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      update_canvas_pyramid                                                 *
+ *  Purpose:                                                                  *
+ *      Updates every level of a pyramid for new parameters, recomputing only *
+ *      what changed.                                                         *
+ *  Arguments:                                                                *
+ *      pyramid (CanvasPyramid * const):                                      *
+ *          The pyramid being updated.                                        *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the full grid, level zero.                 *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature float(float x, float y).       *
+ *  Output:                                                                   *
+ *      views_changed (unsigned int):                                         *
+ *          Non-zero if the buffers of any level moved, or an index type      *
+ *          changed, in which case the views into them must be re-created.    *
+ *  Notes:                                                                    *
+ *      The number of levels is kept, each level is updated with              *
+ *      update_canvas.                                                        *
+ ******************************************************************************/
+template <typename F>
+inline unsigned int
+update_canvas_pyramid(CanvasPyramid * const pyramid,
+                      const CanvasParameters * const parameters,
+                      const F& f)
+{
+    unsigned int views_changed = 0U;
+
+    for (unsigned int level = 0U; level < pyramid->number_of_levels; ++level)
+    {
+        const CanvasParameters level_parameters =
+            pyramid_level_parameters(parameters, level);
+
+        Canvas * const canvas = &pyramid->levels[level];
+        const CanvasUpdate update = update_canvas(canvas, &level_parameters, f);
+        views_changed |= update.views_changed;
+    }
+
+    return views_changed;
+}
+/*  End of update_canvas_pyramid.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      sample_vector_field                                                   *
+ *  Purpose:                                                                  *
+ *      Evaluates a vector field at every point of a grid, writing the arrows *
+ *      to the instance buffer.                                               *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid, from allocate_vector_field or create_vector_field.      *
+ *      f (const F&):                                                         *
+ *          A functor or lambda with signature Vec3(Vec3 position, float      *
+ *          time).                                                            *
+ *      time (float):                                                         *
+ *          The time the field is evaluated at, for animated fields.          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+template <typename F>
+inline void
+sample_vector_field(VectorFieldGrid * const grid, const F& f, float time)
+{
+    PROFILE_START;
+    sample_field_grid(grid, evaluate_field<F>, &f, time);
+    PROFILE_STOP(VectorFieldKernel, grid->number_of_instances);
+}
+/*  End of sample_vector_field.                                               */
+
+}
+/*  End of namespace threetools.                                              */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,66 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Transforms a canvas by a 4x4 matrix and updates what is rendered.     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and Mat4 typedefs found here.                                      */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_canvas                                                      *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to the mesh of a canvas, and brings the output   *
+ *      buffer, normals, and colors up to date.                               *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas for the animation. This contains geometry and buffers. *
+ *      matrix (const Mat4 * const):                                          *
+ *          The transform, with column-major entries like a three.js Matrix4. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      This is the transform_mesh version of z_rotate_canvas. The mesh itself*
+ *      is transformed, for absolute rotations the output is the transformed  *
+ *      mesh rotated by the total angle. General transforms do not preserve   *
+ *      normals, so they are recomputed rather than transformed. The heights  *
+ *      may change too, so the colors are recomputed from the new output.     *
+ ******************************************************************************/
+void transform_canvas(Canvas * const canvas, const Mat4 * const matrix)
+{
+    transform_mesh(canvas, matrix);
+
+    /*  Bring the output buffer, which is what is rendered, up to date.       */
+    update_output_buffer(canvas);
+
+    if (canvas->normals)
+        compute_canvas_normals(canvas);
+
+    /*  Canvases with a color map are colored by height, as in                *
+     *  homotopy_canvas. This does nothing for canvases without one.          */
+    color_canvas(canvas);
+}
+/*  End of transform_canvas.                                                  */
@@ -0,0 +1,262 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to every point in the mesh of a canvas.          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas and Mat4 typedefs found here.                                      */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/*  SIMD128 helpers, only used if compiled with -msimd128.                    */
+#include <threetools/simd.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_point                                                       *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to a single point.                               *
+ *  Arguments:                                                                *
+ *      m (const float * const):                                              *
+ *          The sixteen entries of the matrix, column-major.                  *
+ *      point (Vec3 * const):                                                 *
+ *          The point being transformed, overwritten by the result.           *
+ *      affine (int):                                                         *
+ *          Whether the last row of the matrix is (0, 0, 0, 1). If not, the   *
+ *          point is divided by its w component.                              *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+transform_point(const float * const m, Vec3 * const point, int affine)
+{
+    /*  Each component is a row of the matrix dotted with (x, y, z, 1).       */
+    const float x = m[0]*point->x + m[4]*point->y + m[8]*point->z + m[12];
+    const float y = m[1]*point->x + m[5]*point->y + m[9]*point->z + m[13];
+    const float z = m[2]*point->x + m[6]*point->y + m[10]*point->z + m[14];
+
+    /*  Affine transforms have w = 1, skip the division.                      */
+    if (affine)
+    {
+        point->x = x;
+        point->y = y;
+        point->z = z;
+    }
+
+    else
+    {
+        const float w =
+            m[3]*point->x + m[7]*point->y + m[11]*point->z + m[15];
+
+        point->x = x / w;
+        point->y = y / w;
+        point->z = z / w;
+    }
+}
+/*  End of transform_point.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_planar_mesh                                                 *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to a planar mesh.                                *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being transformed.               *
+ *      m (const float * const):                                              *
+ *          The sixteen entries of the matrix, column-major.                  *
+ *      affine (int):                                                         *
+ *          Whether the last row of the matrix is (0, 0, 0, 1).               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+transform_planar_mesh(Canvas * const canvas,
+                      const float * const m,
+                      int affine)
+{
+    /*  Variable for indexing over the points in the mesh.                    */
+    unsigned int index = 0U;
+
+    /*  The x values are first, followed by the y values, then the z values.  */
+    float * const x = canvas->mesh;
+    float * const y = x + canvas->number_of_points;
+    float * const z = y + canvas->number_of_points;
+
+#if defined(__wasm_simd128__)
+
+    /*  The entries are the same for every point, splat them.                 */
+    v128_t entries[16];
+    unsigned int n;
+
+    for (n = 0U; n < 16U; ++n)
+        entries[n] = wasm_f32x4_splat(m[n]);
+
+    /*  Transform four points at a time. The planes are contiguous, so these  *
+     *  are plain loads and stores.                                           */
+    for (; index + 4U <= canvas->number_of_points; index += 4U)
+    {
+        v128_t xv = wasm_v128_load(x + index);
+        v128_t yv = wasm_v128_load(y + index);
+        v128_t zv = wasm_v128_load(z + index);
+
+        simd_transform_xyz4(&xv, &yv, &zv, entries, affine);
+
+        wasm_v128_store(x + index, xv);
+        wasm_v128_store(y + index, yv);
+        wasm_v128_store(z + index, zv);
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < canvas->number_of_points; ++index)
+    {
+        Vec3 point;
+        point.x = x[index];
+        point.y = y[index];
+        point.z = z[index];
+
+        transform_point(m, &point, affine);
+
+        x[index] = point.x;
+        y[index] = point.y;
+        z[index] = point.z;
+    }
+}
+/*  End of transform_planar_mesh.                                             */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_interleaved_mesh                                            *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to an interleaved mesh.                          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being transformed.               *
+ *      m (const float * const):                                              *
+ *          The sixteen entries of the matrix, column-major.                  *
+ *      affine (int):                                                         *
+ *          Whether the last row of the matrix is (0, 0, 0, 1).               *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ ******************************************************************************/
+static void
+transform_interleaved_mesh(Canvas * const canvas,
+                           const float * const m,
+                           int affine)
+{
+    /*  Variable for indexing over the points in the mesh.                    */
+    unsigned int index = 0U;
+
+#if defined(__wasm_simd128__)
+
+    /*  The entries are the same for every point, splat them.                 */
+    v128_t entries[16];
+    unsigned int n;
+
+    for (n = 0U; n < 16U; ++n)
+        entries[n] = wasm_f32x4_splat(m[n]);
+
+    /*  Transform four points, twelve floats, at a time. The components are   *
+     *  split into their own vectors, transformed, and interleaved again.     */
+    for (; index + 4U <= canvas->number_of_points; index += 4U)
+    {
+        float * const data = canvas->mesh + 3U * index;
+        v128_t xv, yv, zv;
+
+        simd_load_xyz4(data, &xv, &yv, &zv);
+        simd_transform_xyz4(&xv, &yv, &zv, entries, affine);
+        simd_store_xyz4(data, xv, yv, zv);
+    }
+    /*  End of SIMD for-loop.                                                 */
+
+#endif
+/*  End of #if defined(__wasm_simd128__).                                     */
+
+    /*  Loop through each (remaining) point in the mesh.                      */
+    for (; index < canvas->number_of_points; ++index)
+    {
+        float * const data = canvas->mesh + 3U * index;
+        Vec3 point;
+        point.x = data[0];
+        point.y = data[1];
+        point.z = data[2];
+
+        transform_point(m, &point, affine);
+
+        data[0] = point.x;
+        data[1] = point.y;
+        data[2] = point.z;
+    }
+}
+/*  End of transform_interleaved_mesh.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transform_mesh                                                        *
+ *  Purpose:                                                                  *
+ *      Applies a 4x4 matrix to every point in the mesh of a canvas.          *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas with the mesh that is being transformed.               *
+ *      matrix (const Mat4 * const):                                          *
+ *          The transform, with column-major entries like a three.js Matrix4. *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Rotations, scales, and translations are affine, and the last row of   *
+ *      their matrix is (0, 0, 0, 1). Projections are not, and each point is  *
+ *      divided by its w component. Several transforms may be composed with   *
+ *      compose_transforms and applied in a single pass. Like rotate_mesh, the*
+ *      output buffer and normals are not updated, see transform_canvas. The  *
+ *      mesh is flagged as transformed, so update_canvas keeps none of it.    *
+ ******************************************************************************/
+void transform_mesh(Canvas * const canvas, const Mat4 * const matrix)
+{
+    const float * const m = matrix->entries;
+
+    /*  The division by w is only needed when the last row is not trivial.    */
+    const int affine =
+        m[3] == 0.0F && m[7] == 0.0F && m[11] == 0.0F && m[15] == 1.0F;
+
+    PROFILE_START;
+
+    /*  The kernel depends on how the mesh is stored.                         */
+    if (canvas->layout == PlanarLayout)
+        transform_planar_mesh(canvas, m, affine);
+    else
+        transform_interleaved_mesh(canvas, m, affine);
+
+    PROFILE_STOP(TransformKernel, canvas->number_of_points);
+
+    /*  The rows no longer match the surface, new rows would not match them.  */
+    canvas->mesh_transformed = 1U;
+}
+/*  End of transform_mesh.                                                    */
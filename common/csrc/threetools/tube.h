@@ -0,0 +1,543 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides helpers for sweeping a circle along a curve to make a tube.  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_TUBE_H
+#define THREETOOLS_TUBE_H
+
+/*  atan2f, cosf, fabsf, sinf, and sqrtf found here.                          */
+#include <math.h>
+
+/*  Canvas and Vec3 typedefs provided here.                                   */
+#include <threetools/types.h>
+
+/*  grid_step and horizontal_gluing, for the points around the circle.        */
+#include <threetools/gluing.h>
+
+/*  A frame along the curve: the point, the unit tangent, and a unit normal   *
+ *  perpendicular to it. The binormal is the cross product of the tangent and *
+ *  normal.                                                                   */
+typedef struct TubeFrame {
+    Vec3 point, tangent, normal;
+} TubeFrame;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_sub                                                              *
+ *  Purpose:                                                                  *
+ *      Computes the difference of two vectors.                               *
+ *  Arguments:                                                                *
+ *      a (Vec3):                                                             *
+ *          The first vector.                                                 *
+ *      b (Vec3):                                                             *
+ *          The second vector.                                                *
+ *  Output:                                                                   *
+ *      difference (Vec3):                                                    *
+ *          The vector a - b.                                                 *
+ ******************************************************************************/
+static inline Vec3 tube_sub(Vec3 a, Vec3 b)
+{
+    Vec3 difference;
+    difference.x = a.x - b.x;
+    difference.y = a.y - b.y;
+    difference.z = a.z - b.z;
+    return difference;
+}
+/*  End of tube_sub.                                                          */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_dot                                                              *
+ *  Purpose:                                                                  *
+ *      Computes the dot product of two vectors.                              *
+ *  Arguments:                                                                *
+ *      a (Vec3):                                                             *
+ *          The first vector.                                                 *
+ *      b (Vec3):                                                             *
+ *          The second vector.                                                *
+ *  Output:                                                                   *
+ *      dot (float):                                                          *
+ *          The Euclidean dot product of a and b.                             *
+ ******************************************************************************/
+static inline float tube_dot(Vec3 a, Vec3 b)
+{
+    return a.x*b.x + a.y*b.y + a.z*b.z;
+}
+/*  End of tube_dot.                                                          */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_cross                                                            *
+ *  Purpose:                                                                  *
+ *      Computes the cross product of two vectors.                            *
+ *  Arguments:                                                                *
+ *      a (Vec3):                                                             *
+ *          The first vector.                                                 *
+ *      b (Vec3):                                                             *
+ *          The second vector.                                                *
+ *  Output:                                                                   *
+ *      cross (Vec3):                                                         *
+ *          The vector a x b.                                                 *
+ ******************************************************************************/
+static inline Vec3 tube_cross(Vec3 a, Vec3 b)
+{
+    Vec3 cross;
+    cross.x = a.y*b.z - a.z*b.y;
+    cross.y = a.z*b.x - a.x*b.z;
+    cross.z = a.x*b.y - a.y*b.x;
+    return cross;
+}
+/*  End of tube_cross.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_reflect                                                          *
+ *  Purpose:                                                                  *
+ *      Reflects a vector across the plane perpendicular to another.          *
+ *  Arguments:                                                                *
+ *      a (Vec3):                                                             *
+ *          The vector being reflected.                                       *
+ *      b (Vec3):                                                             *
+ *          The normal to the plane of reflection. This need not be a unit    *
+ *          vector.                                                           *
+ *      norm_sq (float):                                                      *
+ *          The square of the length of b. Zero leaves a unchanged.           *
+ *  Output:                                                                   *
+ *      reflection (Vec3):                                                    *
+ *          The vector a - 2 (a . b / b . b) b.                               *
+ ******************************************************************************/
+static inline Vec3 tube_reflect(Vec3 a, Vec3 b, float norm_sq)
+{
+    float factor;
+
+    /*  Consecutive samples may coincide, there is nothing to reflect across. */
+    if (norm_sq == 0.0F)
+        return a;
+
+    factor = 2.0F * tube_dot(a, b) / norm_sq;
+    a.x -= factor * b.x;
+    a.y -= factor * b.y;
+    a.z -= factor * b.z;
+    return a;
+}
+/*  End of tube_reflect.                                                      */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_normalize                                                        *
+ *  Purpose:                                                                  *
+ *      Scales a vector to unit length.                                       *
+ *  Arguments:                                                                *
+ *      a (Vec3):                                                             *
+ *          The vector being normalized.                                      *
+ *  Output:                                                                   *
+ *      unit (Vec3):                                                          *
+ *          The unit vector in the direction of a, or a itself if it is zero. *
+ ******************************************************************************/
+static inline Vec3 tube_normalize(Vec3 a)
+{
+    const float norm = sqrtf(tube_dot(a, a));
+
+    if (norm == 0.0F)
+        return a;
+
+    a.x /= norm;
+    a.y /= norm;
+    a.z /= norm;
+    return a;
+}
+/*  End of tube_normalize.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_initial_frame                                                    *
+ *  Purpose:                                                                  *
+ *      Creates the first frame of a tube from the first point and tangent.   *
+ *  Arguments:                                                                *
+ *      point (Vec3):                                                         *
+ *          The first point of the curve.                                     *
+ *      tangent (Vec3):                                                       *
+ *          The unit tangent at the first point.                              *
+ *  Output:                                                                   *
+ *      frame (TubeFrame):                                                    *
+ *          The frame, with a normal perpendicular to the tangent.            *
+ ******************************************************************************/
+static inline TubeFrame tube_initial_frame(Vec3 point, Vec3 tangent)
+{
+    TubeFrame frame;
+    Vec3 axis = {0.0F, 0.0F, 0.0F};
+
+    /*  Use the coordinate axis that is the least parallel to the tangent,    *
+     *  the cross product with it is never small.                             */
+    const float x = fabsf(tangent.x);
+    const float y = fabsf(tangent.y);
+    const float z = fabsf(tangent.z);
+
+    if (x <= y && x <= z)
+        axis.x = 1.0F;
+    else if (y <= z)
+        axis.y = 1.0F;
+    else
+        axis.z = 1.0F;
+
+    frame.point = point;
+    frame.tangent = tangent;
+    frame.normal = tube_normalize(tube_cross(tangent, axis));
+    return frame;
+}
+/*  End of tube_initial_frame.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_next_frame                                                       *
+ *  Purpose:                                                                  *
+ *      Transports a frame to the next point of the curve with the double     *
+ *      reflection method.                                                    *
+ *  Arguments:                                                                *
+ *      frame (const TubeFrame * const):                                      *
+ *          The frame at the previous point.                                  *
+ *      point (Vec3):                                                         *
+ *          The next point of the curve.                                      *
+ *      tangent (Vec3):                                                       *
+ *          The unit tangent at the next point.                               *
+ *  Output:                                                                   *
+ *      next (TubeFrame):                                                     *
+ *          The rotation-minimizing frame at the next point.                  *
+ ******************************************************************************/
+static inline TubeFrame
+tube_next_frame(const TubeFrame * const frame, Vec3 point, Vec3 tangent)
+{
+    TubeFrame next;
+
+    /*  Reflect the frame across the plane bisecting the two points. This     *
+     *  maps the previous point to the next one, but the tangent is off.      */
+    const Vec3 chord = tube_sub(point, frame->point);
+    const float chord_sq = tube_dot(chord, chord);
+    const Vec3 normal = tube_reflect(frame->normal, chord, chord_sq);
+    const Vec3 reflected_tangent =
+        tube_reflect(frame->tangent, chord, chord_sq);
+
+    /*  A second reflection lines the tangent up with the actual tangent.     *
+     *  The two reflections give a rotation, with almost no twist about the   *
+     *  curve, see Wang, Juttler, Zheng, and Liu, 2008.                       */
+    const Vec3 correction = tube_sub(tangent, reflected_tangent);
+    const float correction_sq = tube_dot(correction, correction);
+
+    next.point = point;
+    next.tangent = tangent;
+    next.normal = tube_normalize(
+        tube_reflect(normal, correction, correction_sq)
+    );
+
+    return next;
+}
+/*  End of tube_next_frame.                                                   */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_holonomy                                                         *
+ *  Purpose:                                                                  *
+ *      Computes the angle a rotation-minimizing frame turns by after going   *
+ *      around a closed curve.                                                *
+ *  Arguments:                                                                *
+ *      first (const TubeFrame * const):                                      *
+ *          The frame at the start of the curve.                              *
+ *      last (const TubeFrame * const):                                       *
+ *          The frame transported all the way around, back to the start.      *
+ *  Output:                                                                   *
+ *      angle (float):                                                        *
+ *          The angle, about the first tangent, from the first normal to the  *
+ *          last one.                                                         *
+ ******************************************************************************/
+static inline float
+tube_holonomy(const TubeFrame * const first, const TubeFrame * const last)
+{
+    const Vec3 cross = tube_cross(first->normal, last->normal);
+    const float sin_angle = tube_dot(cross, first->tangent);
+    const float cos_angle = tube_dot(first->normal, last->normal);
+    return atan2f(sin_angle, cos_angle);
+}
+/*  End of tube_holonomy.                                                     */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_write_ring                                                       *
+ *  Purpose:                                                                  *
+ *      Writes the circle about one point of the curve to a row of the mesh.  *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, one row per point of the curve and one column per     *
+ *          point of the circle.                                              *
+ *      row (unsigned int):                                                   *
+ *          The row being written.                                            *
+ *      frame (const TubeFrame * const):                                      *
+ *          The frame at the point of the curve.                              *
+ *      twist (float):                                                        *
+ *          Extra rotation of the frame about the tangent, used to close up   *
+ *          tubes around closed curves.                                       *
+ *      radius (float):                                                       *
+ *          The radius of the tube.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The angle around the circle starts at the horizontal start of the     *
+ *      canvas and covers its width. The cosine and sine are rotated from one *
+ *      point to the next rather than computed again.                         *
+ ******************************************************************************/
+static inline void
+tube_write_ring(Canvas * const canvas,
+                unsigned int row,
+                const TubeFrame * const frame,
+                float twist,
+                float radius)
+{
+    /*  Step size around the circle, 2 pi / nx_pts for a full circle.         */
+    const EdgeGluing horizontal = horizontal_gluing(canvas->mesh_type);
+    const float step = grid_step(canvas->width, canvas->nx_pts, horizontal);
+    const float cos_step = cosf(step);
+    const float sin_step = sinf(step);
+
+    /*  Offsets to the y and z components, and the step between consecutive   *
+     *  points, for the given layout.                                         */
+    const unsigned int y_offset =
+        (canvas->layout == PlanarLayout ? canvas->number_of_points : 1U);
+
+    const unsigned int z_offset = 2U * y_offset;
+    const unsigned int stride = (canvas->layout == PlanarLayout ? 1U : 3U);
+    unsigned int index = row * canvas->nx_pts * stride;
+
+    /*  The circle lies in the plane of the normal and binormal. Turning the  *
+     *  frame by the twist is the same as starting the circle further along.  */
+    const Vec3 binormal = tube_cross(frame->tangent, frame->normal);
+    float cos_angle = cosf(canvas->horizontal_start + twist);
+    float sin_angle = sinf(canvas->horizontal_start + twist);
+    unsigned int column;
+
+    for (column = 0U; column < canvas->nx_pts; ++column)
+    {
+        const float n = radius * cos_angle;
+        const float b = radius * sin_angle;
+        const float previous_cos = cos_angle;
+
+        canvas->mesh[index] =
+            frame->point.x + n * frame->normal.x + b * binormal.x;
+
+        canvas->mesh[index + y_offset] =
+            frame->point.y + n * frame->normal.y + b * binormal.y;
+
+        canvas->mesh[index + z_offset] =
+            frame->point.z + n * frame->normal.z + b * binormal.z;
+
+        /*  Rotate to the next angle around the circle.                       */
+        cos_angle = previous_cos * cos_step - sin_angle * sin_step;
+        sin_angle = sin_angle * cos_step + previous_cos * sin_step;
+        index += stride;
+    }
+}
+/*  End of tube_write_ring.                                                   */
+
+/*  Evaluates the curve of a tube, given the data pointer passed to           *
+ *  store_tube_rows. The C function passes a pointer to the function pointer, *
+ *  and the template in threetools.hpp a pointer to the functor, see rows.h.  */
+typedef Vec3 (*CurveEvaluator)(const void * const data, float t);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_curve_sample                                                     *
+ *  Purpose:                                                                  *
+ *      Evaluates a curve and its unit tangent.                               *
+ *  Arguments:                                                                *
+ *      curve (CurveEvaluator):                                               *
+ *          Evaluates the curve, given data.                                  *
+ *      data (const void * const):                                            *
+ *          The curve, passed on to curve.                                    *
+ *      t (float):                                                            *
+ *          The parameter of the point.                                       *
+ *      h (float):                                                            *
+ *          Half of the step used for the central difference.                 *
+ *  Output:                                                                   *
+ *      frame (TubeFrame):                                                    *
+ *          The point and unit tangent. The normal is not set.                *
+ *  Notes:                                                                    *
+ *      The tangent is the central difference (curve(t + h) - curve(t - h)) / *
+ *      2h, normalized. With h half of the grid step this is accurate to      *
+ *      second order, and the curve does not need to provide its derivative.  *
+ ******************************************************************************/
+static inline TubeFrame
+tube_curve_sample(CurveEvaluator curve,
+                  const void * const data,
+                  float t,
+                  float h)
+{
+    TubeFrame frame;
+    const Vec3 ahead = curve(data, t + h);
+    const Vec3 behind = curve(data, t - h);
+
+    frame.point = curve(data, t);
+    frame.tangent = tube_normalize(tube_sub(ahead, behind));
+    return frame;
+}
+/*  End of tube_curve_sample.                                                 */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_advance_frame                                                    *
+ *  Purpose:                                                                  *
+ *      Samples the curve at the next row and transports the frame there.     *
+ *  Arguments:                                                                *
+ *      frame (const TubeFrame * const):                                      *
+ *          The frame at the previous row.                                    *
+ *      curve (CurveEvaluator):                                               *
+ *          Evaluates the curve, given data.                                  *
+ *      data (const void * const):                                            *
+ *          The curve, passed on to curve.                                    *
+ *      t (float):                                                            *
+ *          The parameter of the next row.                                    *
+ *      h (float):                                                            *
+ *          Half of the step between rows, for the tangent.                   *
+ *  Output:                                                                   *
+ *      next (TubeFrame):                                                     *
+ *          The rotation-minimizing frame at the next row.                    *
+ ******************************************************************************/
+static inline TubeFrame
+tube_advance_frame(const TubeFrame * const frame,
+                   CurveEvaluator curve,
+                   const void * const data,
+                   float t,
+                   float h)
+{
+    const TubeFrame sample = tube_curve_sample(curve, data, t, h);
+    return tube_next_frame(frame, sample.point, sample.tangent);
+}
+/*  End of tube_advance_frame.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      tube_closing_twist                                                    *
+ *  Purpose:                                                                  *
+ *      Finds how far the frame turns on the way around a closed curve, the   *
+ *      twist that is undone over the rows so that the tube closes up.        *
+ *  Arguments:                                                                *
+ *      canvas (const Canvas * const):                                        *
+ *          The canvas, one row per point of the curve.                       *
+ *      first (const TubeFrame * const):                                      *
+ *          The frame at the first row.                                       *
+ *      curve (CurveEvaluator):                                               *
+ *          Evaluates the curve, given data.                                  *
+ *      data (const void * const):                                            *
+ *          The curve, passed on to curve.                                    *
+ *  Output:                                                                   *
+ *      holonomy (float):                                                     *
+ *          The angle the frame turns by, zero for open curves.               *
+ *  Notes:                                                                    *
+ *      The frame is transported all the way around, back to the first point, *
+ *      in a pass over the curve that does not write to the mesh.             *
+ ******************************************************************************/
+static inline float
+tube_closing_twist(const Canvas * const canvas,
+                   const TubeFrame * const first,
+                   CurveEvaluator curve,
+                   const void * const data)
+{
+    const EdgeGluing vertical = vertical_gluing(canvas->mesh_type);
+    const float dt = grid_step(canvas->height, canvas->ny_pts, vertical);
+    TubeFrame frame = *first;
+    unsigned int row;
+
+    if (vertical == NoGluing)
+        return 0.0F;
+
+    /*  Row ny_pts is the first row again, one period later.                  */
+    for (row = 1U; row <= canvas->ny_pts; ++row)
+    {
+        const float t = canvas->vertical_start + (float)(row) * dt;
+        frame = tube_advance_frame(&frame, curve, data, t, 0.5F * dt);
+    }
+
+    return tube_holonomy(first, &frame);
+}
+/*  End of tube_closing_twist.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      store_tube_rows                                                       *
+ *  Purpose:                                                                  *
+ *      Computes the vertices of a tube of constant radius around a curve.    *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas, one row per point of the curve and one column per     *
+ *          point of the circle.                                              *
+ *      curve (CurveEvaluator):                                               *
+ *          Evaluates the curve, given data.                                  *
+ *      data (const void * const):                                            *
+ *          The curve, passed on to curve.                                    *
+ *      radius (float):                                                       *
+ *          The radius of the tube.                                           *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      The twist from tube_closing_twist is undone a little at a time, so    *
+ *      the last row joins the first. The frames are carried from one row to  *
+ *      the next, so the rows are not split across threads.                   *
+ ******************************************************************************/
+static inline void
+store_tube_rows(Canvas * const canvas,
+                CurveEvaluator curve,
+                const void * const data,
+                float radius)
+{
+    /*  Step size along the curve. Closed curves are sampled periodically.    */
+    const EdgeGluing vertical = vertical_gluing(canvas->mesh_type);
+    const float dt = grid_step(canvas->height, canvas->ny_pts, vertical);
+    const float h = 0.5F * dt;
+
+    /*  The first frame, every other frame is transported from it.            */
+    const TubeFrame sample =
+        tube_curve_sample(curve, data, canvas->vertical_start, h);
+
+    const TubeFrame first = tube_initial_frame(sample.point, sample.tangent);
+    const float holonomy = tube_closing_twist(canvas, &first, curve, data);
+    TubeFrame frame = first;
+    unsigned int row;
+
+    for (row = 0U; row < canvas->ny_pts; ++row)
+    {
+        /*  Undo the turn a little at a time, the last row joins the first.   */
+        const float twist =
+            -holonomy * (float)(row) / (float)(canvas->ny_pts);
+
+        if (row > 0U)
+        {
+            const float t = canvas->vertical_start + (float)(row) * dt;
+            frame = tube_advance_frame(&frame, curve, data, t, h);
+        }
+
+        tube_write_ring(canvas, row, &frame, twist, radius);
+    }
+}
+/*  End of store_tube_rows.                                                   */
+
+#endif
+/*  End of include guard.                                                     */
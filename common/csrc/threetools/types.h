@@ -30,6 +30,47 @@
 /*  Parametrization for surfaces of the form z = f(x, y).                     */
 typedef float (*SurfaceParametrization)(float x, float y);
 
+/*  A point, or vector, in three dimensional space.                           */
+typedef struct Vec3 {
+    float x, y, z;
+} Vec3;
+
+/*  Parametrization for general surfaces, (u, v) -> (x, y, z). Spheres, tori, *
+ *  Mobius strips, and Klein bottles can not be written as z = f(x, y).       */
+typedef Vec3 (*ParametricSurface)(float u, float v);
+
+/*  Batched version of ParametricSurface, evaluating several points in one    *
+ *  row of the grid at once. The u array has length elements, v is the same   *
+ *  for every point, and the results are written to the x, y, and z arrays.   *
+ *  Without a function call per point the compiler is free to vectorize the   *
+ *  body of the surface.                                                      */
+typedef void
+(*ParametricSurfaceBatch)(const float *u, float v, unsigned int length,
+                          float *x, float *y, float *z);
+
+/*  Parametrization for curves in space, t -> (x, y, z). Tubes around these   *
+ *  are used for knots, see generate_tube_mesh.                               */
+typedef Vec3 (*ParametricCurve)(float t);
+
+/*  A parameter of a separable surface, with its cosine and sine, and those   *
+ *  of half of it. These are computed once per column and once per row.       */
+typedef struct AxisSample {
+    float value, cos_value, sin_value, cos_half, sin_half;
+} AxisSample;
+
+/*  Parametrization for surfaces that depend on u and v only through the      *
+ *  values in their axis samples, like the sphere, torus, Mobius strip, and   *
+ *  Klein bottle. The surface is evaluated with no trig calls per point.      */
+typedef Vec3
+(*SeparableSurface)(const AxisSample * const u, const AxisSample * const v);
+
+/*  A 4x4 matrix for affine and projective transforms of points. The entries  *
+ *  are column-major, the same as the elements of a three.js Matrix4, so the  *
+ *  entry in a given row and column is entries[4 * column + row].             */
+typedef struct Mat4 {
+    float entries[16];
+} Mat4;
+
 /*  Vector struct used for rotating points about the z axis.                  */
 typedef struct UnitVector {
     float cos_angle, sin_angle;
@@ -51,24 +92,227 @@ typedef enum MeshType {
     ProjectiveTriangleWireframe
 } MeshType;
 
-/*  Struct with the geometry and buffers for the animation.                   */
+/*  enum for how opposite edges of the rectangular grid are connected. No     *
+ *  gluing leaves the edge as a boundary, straight gluing connects (end, t)   *
+ *  to (0, t), and twisted gluing connects (end, t) to (0, n - 1 - t),        *
+ *  reversing the orientation. A cylinder glues one pair of edges straight, a *
+ *  Mobius strip twists it, and the torus, Klein bottle, and projective plane *
+ *  glue both pairs.                                                          */
+typedef enum EdgeGluing {
+    NoGluing,
+    StraightGluing,
+    TwistedGluing
+} EdgeGluing;
+
+/*  enum for how the vertices are stored in the mesh buffer. Interleaved is   *
+ *  (x0, y0, z0, x1, y1, z1, ...), which is what three.js expects. Planar     *
+ *  stores all of the x values, then all of the y values, then the z values.  */
+typedef enum MeshLayout {
+    InterleavedLayout,
+    PlanarLayout
+} MeshLayout;
+
+/*  enum for how z_rotate_canvas rotates a canvas. Incremental rotation       *
+ *  rotates the mesh in place by a small angle every frame, which slowly      *
+ *  accumulates rounding error. Absolute rotation leaves the mesh untouched   *
+ *  and writes the mesh rotated by the total angle into the output buffer.    */
+typedef enum RotationMode {
+    IncrementalRotation,
+    AbsoluteRotation
+} RotationMode;
+
+/*  enum for the element type of the index buffer. Meshes with at most 65535  *
+ *  vertices use 16-bit indices, halving the size of the index buffer. Larger *
+ *  meshes need the full 32 bits.                                             */
+typedef enum IndexType {
+    Uint32Indices,
+    Uint16Indices
+} IndexType;
+
+/*  The shape of the grid that an index buffer was generated for. The line    *
+ *  segments depend only on these, and not on the surface or the domain, so   *
+ *  an index buffer with a matching topology can be reused as is.             */
+typedef struct IndexTopology {
+    unsigned int nx_pts, ny_pts;
+    MeshType mesh_type;
+} IndexTopology;
+
+/*  Number of entries in the lookup table of a color map.                     */
+#define COLOR_MAP_SIZE (256U)
+
+/*  A color map, from a scalar value to a color, sampled into a lookup table. *
+ *  The table has COLOR_MAP_SIZE packed RGB entries, one byte per channel,    *
+ *  evenly spaced from min_value to max_value. Values outside of this range   *
+ *  are clamped. The index factor is (COLOR_MAP_SIZE - 1) / (max - min), so   *
+ *  no division is needed per point.                                          */
+typedef struct ColorMap {
+    unsigned char table[3U * COLOR_MAP_SIZE];
+    float min_value, max_value, index_factor;
+} ColorMap;
+
+/*  enum for the kernels timed by the profiling build, see profile.h. Each    *
+ *  counter times the whole call, so ZRotateKernel includes the rotations and *
+ *  normals it computes. The fused coloring done while generating a mesh is   *
+ *  counted with the mesh, ColorsKernel only counts color_canvas.             */
+typedef enum ProfileKernel {
+    ParametricMeshKernel,
+    SurfaceMeshKernel,
+    WireframeKernel,
+    RotateMeshKernel,
+    RotateToOutputKernel,
+    PackPlanarKernel,
+    ZRotateKernel,
+    NormalsKernel,
+    ColorsKernel,
+    HomotopyKernel,
+    VectorFieldKernel,
+    FusedWireframeKernel,
+    TransformKernel,
+    TubeMeshKernel
+} ProfileKernel;
+
+/*  Number of kernels in the ProfileKernel enum.                              */
+#define PROFILE_KERNEL_COUNT (14U)
+
+/*  Counters for one kernel: the number of calls, the number of points        *
+ *  processed, and the total time spent, in nanoseconds. These are doubles so *
+ *  that they survive the trip to JavaScript and do not overflow, they are    *
+ *  exact up to 2^53.                                                         */
+typedef struct KernelCounter {
+    double calls, points, nanoseconds;
+} KernelCounter;
+
+/*  Struct with the geometry and buffers for the animation. The output buffer *
+ *  is what is rendered, it is interleaved. For interleaved layouts this is   *
+ *  the same as the mesh buffer, for planar layouts it is a packed copy. For  *
+ *  absolute rotations it is the mesh rotated by the total angle. The back    *
+ *  buffer, if any, is a second output buffer for double buffering, it is     *
+ *  swapped with the output buffer by swap_output_buffers. The normals, if    *
+ *  any, are the interleaved unit normals of the output buffer, see           *
+ *  compute_canvas_normals. The colors, if any, are packed RGB bytes, one     *
+ *  color per point, from its height and the color map of the canvas, see     *
+ *  set_canvas_color_map. The indices are unsigned short or unsigned int,     *
+ *  depending on the index type, and hold the wireframe for the index         *
+ *  topology. The capacities are the number of bytes allocated by the canvas  *
+ *  for each buffer, zero for buffers the canvas does not own. The mesh is    *
+ *  flagged as transformed by transform_mesh, its rows no longer match the    *
+ *  surface until the canvas is allocated and generated again.                */
 typedef struct Canvas {
     float *mesh;
-    unsigned int *indices;
+    float *output;
+    float *back_output;
+    float *normals;
+    unsigned char *colors;
+    const ColorMap *color_map;
+    void *indices;
     unsigned int number_of_points, mesh_size, index_size;
+    unsigned int mesh_capacity, output_capacity, index_capacity;
+    unsigned int back_output_capacity, normals_capacity, colors_capacity;
     unsigned int nx_pts, ny_pts;
     float width, height;
     float horizontal_start, vertical_start;
     MeshType mesh_type;
+    IndexType index_type;
+    IndexTopology index_topology;
+    MeshLayout layout;
+    RotationMode rotation_mode;
+    float angle;
+    unsigned int mesh_transformed;
 } Canvas;
 
+/*  A kernel that processes the rows first_row <= y < end_row of a canvas.    *
+ *  The rows of the mesh and of the index buffer are independent, so bands of *
+ *  rows may be processed in parallel, see parallel_rows. The data pointer    *
+ *  holds whatever else the kernel needs, like the surface.                   */
+typedef void
+(*RowKernel)(Canvas * const canvas, const void * const data,
+             unsigned int first_row, unsigned int end_row);
+
 /*  Stripped down version of a Canvas. Used at the JavaScript / Godot level.  */
 typedef struct CanvasParameters {
     unsigned int nx_pts, ny_pts;
     float width, height;
     float x_start, y_start;
     MeshType mesh_type;
+    MeshLayout layout;
+    RotationMode rotation_mode;
 } CanvasParameters;
 
+/*  Maximum number of levels in a CanvasPyramid.                              */
+#define CANVAS_PYRAMID_MAX_LEVELS (8U)
+
+/*  A level-of-detail pyramid of canvases for the same surface and domain.    *
+ *  Level zero is the full grid, and each level after it halves the number of *
+ *  points along both axes, 512, 256, 128, 64, and so on. Each level has its  *
+ *  own buffers and caches the topology of its index buffer, so regenerating  *
+ *  the pyramid for a new surface or domain only recomputes the vertices.     *
+ *  Levels past number_of_levels are empty.                                   */
+typedef struct CanvasPyramid {
+    Canvas levels[CANVAS_PYRAMID_MAX_LEVELS];
+    unsigned int number_of_levels;
+} CanvasPyramid;
+
+/*  The parts of a canvas changed by update_canvas. The rows from first_row   *
+ *  onward were recomputed. The ranges are in elements, not bytes, of the     *
+ *  output and index buffers, which is what BufferAttribute.addUpdateRange    *
+ *  expects. If views_changed is set, the buffers moved or the index type     *
+ *  changed, and the views into them must be re-created and uploaded in full. *
+ *  Buffers never shrink, so otherwise views made for a grid with at least as *
+ *  many points are still valid. If normals_changed is set, the normals were  *
+ *  recomputed. This happens when rows change, and also when rows are only    *
+ *  removed, since the new last row is then a boundary row.                   */
+typedef struct CanvasUpdate {
+    unsigned int first_row;
+    unsigned int output_start, output_count;
+    unsigned int index_start, index_count;
+    unsigned int views_changed;
+    unsigned int normals_changed;
+} CanvasUpdate;
+
+/*  A band of rows computed by generate_canvas_band. The rows first_row <= y  *
+ *  < end_row were computed, and the output range, in elements like a         *
+ *  CanvasUpdate, holds their vertices. The index range holds the line        *
+ *  segments that can now be drawn, those whose vertices have all been        *
+ *  computed, so the first index_start + index_count indices may be drawn.    *
+ *  Since segments reach up one row, this lags the band by a row until the    *
+ *  last band. If done is set, the band reached the last row and the mesh is  *
+ *  complete.                                                                 */
+typedef struct CanvasBand {
+    unsigned int first_row, end_row;
+    unsigned int output_start, output_count;
+    unsigned int index_start, index_count;
+    unsigned int done;
+} CanvasBand;
+
+/*  A time dependent vector field, (x, y, z, t) -> (u, v, w). These are       *
+ *  sampled over a grid of points and drawn as arrows.                        */
+typedef Vec3 (*VectorField)(Vec3 position, float time);
+
+/*  Each sample of a vector field is written as seven floats, the position of *
+ *  the arrow, the unit direction it points in, and the magnitude of the      *
+ *  field. This is the stride of the instance buffer, which three.js reads as *
+ *  an InstancedInterleavedBuffer.                                            */
+#define VECTOR_FIELD_INSTANCE_SIZE (7U)
+
+/*  Struct with the sample grid and instance buffer for a vector field. The   *
+ *  grid has nx_pts * ny_pts * nz_pts points, starting at the corner (x_start,*
+ *  y_start, z_start) of a box with the given width, height, and depth. The   *
+ *  instances are ordered with x varying fastest, then y, then z. The         *
+ *  capacity is the number of bytes allocated for the instance buffer.        */
+typedef struct VectorFieldGrid {
+    float *instances;
+    unsigned int number_of_instances, instances_size, instances_capacity;
+    unsigned int nx_pts, ny_pts, nz_pts;
+    float width, height, depth;
+    float x_start, y_start, z_start;
+} VectorFieldGrid;
+
+/*  Stripped down version of a VectorFieldGrid, used at the JavaScript level. */
+typedef struct VectorFieldParameters {
+    unsigned int nx_pts, ny_pts, nz_pts;
+    float width, height, depth;
+    float x_start, y_start, z_start;
+} VectorFieldParameters;
+
 #endif
 /*  End of include guard.                                                     */
@@ -0,0 +1,66 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Incrementally updates a canvas for new parameters.                    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, CanvasParameters, and CanvasUpdate typedefs found here.           */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  run_canvas_update and the kernels for the C API provided here.            */
+#include <threetools/parametric.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      update_canvas                                                         *
+ *  Purpose:                                                                  *
+ *      Updates a canvas for new parameters, recomputing only what changed.   *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas being updated.                                         *
+ *      parameters (const CanvasParameters * const):                          *
+ *          The new parameters for the canvas.                                *
+ *      f (const SurfaceParametrization):                                     *
+ *          The function that defines the surface, z = f(x, y).               *
+ *  Output:                                                                   *
+ *      update (CanvasUpdate):                                                *
+ *          The dirty ranges of the output and index buffers.                 *
+ *  Notes:                                                                    *
+ *      This is an alternative to allocate_canvas followed by                 *
+ *      generate_canvas_wireframe. Rows of the mesh that are unchanged are not*
+ *      recomputed, and the index buffer is skipped if the topology is the    *
+ *      same. If the surface itself changed, and not just the parameters, use *
+ *      generate_canvas_wireframe instead, since every row is different.      *
+ ******************************************************************************/
+CanvasUpdate
+update_canvas(Canvas * const canvas,
+              const CanvasParameters * const parameters,
+              const SurfaceParametrization f)
+{
+    /*  The surface is passed by address, see evaluate_parametrization.       */
+    const ParametricKernels kernels = parametrization_kernels();
+    return run_canvas_update(canvas, parameters, &kernels, &f);
+}
+/*  End of update_canvas.                                                     */
@@ -0,0 +1,68 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Brings the output buffer of a canvas up to date with its mesh.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Canvas, MeshLayout, and RotationMode typedefs provided here.              */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration given here.                      */
+#include <threetools/threetools.h>
+
+/*  cosf and sinf found here.                                                 */
+#include <math.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      update_output_buffer                                                  *
+ *  Purpose:                                                                  *
+ *      Recomputes the output buffer, which is what is rendered, from the     *
+ *      mesh.                                                                 *
+ *  Arguments:                                                                *
+ *      canvas (Canvas * const):                                              *
+ *          The canvas whose output buffer is being updated.                  *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      For absolute rotations the mesh is rotated by the total angle of the  *
+ *      canvas. Otherwise planar meshes are packed, and interleaved meshes are*
+ *      rendered directly and nothing is done.                                *
+ ******************************************************************************/
+void update_output_buffer(Canvas * const canvas)
+{
+    /*  Absolute rotations compute the output from the pristine mesh. The     *
+     *  sine and cosine are computed once per call using the exact functions, *
+     *  the small-angle approximations in set_rotation_angle are not used.    */
+    if (canvas->rotation_mode == AbsoluteRotation)
+    {
+        UnitVector point;
+        point.cos_angle = cosf(canvas->angle);
+        point.sin_angle = sinf(canvas->angle);
+        rotate_mesh_to_output(canvas, point);
+    }
+
+    /*  Planar meshes need to be interleaved before they can be rendered.     */
+    else
+        pack_planar_mesh(canvas);
+}
+/*  End of update_output_buffer.                                              */
@@ -0,0 +1,176 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Provides helpers for sampling a vector field into an instance buffer. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef THREETOOLS_VECTOR_FIELD_H
+#define THREETOOLS_VECTOR_FIELD_H
+
+/*  sqrtf found here.                                                         */
+#include <math.h>
+
+/*  Vec3, VectorFieldGrid, and VECTOR_FIELD_INSTANCE_SIZE provided here.      */
+#include <threetools/types.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      field_step                                                            *
+ *  Purpose:                                                                  *
+ *      Computes the spacing between samples along one axis of a vector field.*
+ *  Arguments:                                                                *
+ *      length (float):                                                       *
+ *          The length of the box along the axis.                             *
+ *      points (unsigned int):                                                *
+ *          The number of samples along the axis.                             *
+ *  Output:                                                                   *
+ *      step (float):                                                         *
+ *          The distance between consecutive samples.                         *
+ *  Notes:                                                                    *
+ *      Both ends of the axis are sampled. A single sample sits at the start  *
+ *      of the axis, the step is zero in this case.                           *
+ ******************************************************************************/
+static inline float field_step(float length, unsigned int points)
+{
+    if (points < 2U)
+        return 0.0F;
+
+    return length / (float)(points - 1U);
+}
+/*  End of field_step.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      write_arrow_instance                                                  *
+ *  Purpose:                                                                  *
+ *      Writes a sample of a vector field to the instance buffer.             *
+ *  Arguments:                                                                *
+ *      instance (float * const):                                             *
+ *          The VECTOR_FIELD_INSTANCE_SIZE floats for this sample.            *
+ *      position (Vec3):                                                      *
+ *          The point the field was evaluated at, the tail of the arrow.      *
+ *      field (Vec3):                                                         *
+ *          The value of the field at this point.                             *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      A zero vector has no direction. The direction and magnitude are both  *
+ *      written as zero, which the shader in vectorFieldArrows scales down to *
+ *      nothing, hiding the arrow. Fields may return zero on purpose to skip  *
+ *      points, like those inside of a charge.                                *
+ ******************************************************************************/
+static inline void
+write_arrow_instance(float * const instance, Vec3 position, Vec3 field)
+{
+    /*  The magnitude is needed for the length of the arrow, and its          *
+     *  reciprocal normalizes the direction.                                  */
+    const float norm_sq = field.x*field.x + field.y*field.y + field.z*field.z;
+    const float magnitude = sqrtf(norm_sq);
+    const float rcpr_magnitude = (magnitude > 0.0F ? 1.0F / magnitude : 0.0F);
+
+    instance[0] = position.x;
+    instance[1] = position.y;
+    instance[2] = position.z;
+    instance[3] = field.x * rcpr_magnitude;
+    instance[4] = field.y * rcpr_magnitude;
+    instance[5] = field.z * rcpr_magnitude;
+    instance[6] = magnitude;
+}
+/*  End of write_arrow_instance.                                              */
+
+/*  Evaluates a vector field, given the data pointer of sample_field_grid.    *
+ *  The C function passes a pointer to the function pointer, and the template *
+ *  in threetools.hpp a pointer to the functor, see rows.h.                   */
+typedef Vec3
+(*FieldEvaluator)(const void * const data, Vec3 position, float time);
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      sample_field_grid                                                     *
+ *  Purpose:                                                                  *
+ *      Evaluates a vector field at every point of a grid, writing the arrows *
+ *      to the instance buffer.                                               *
+ *  Arguments:                                                                *
+ *      grid (VectorFieldGrid * const):                                       *
+ *          The grid, from allocate_vector_field or create_vector_field.      *
+ *      f (FieldEvaluator):                                                   *
+ *          Evaluates the field, given data.                                  *
+ *      data (const void * const):                                            *
+ *          The vector field, passed on to f.                                 *
+ *      time (float):                                                         *
+ *          The time the field is evaluated at, for animated fields.          *
+ *  Output:                                                                   *
+ *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Each point is independent, so the loops have no dependencies across   *
+ *      iterations.                                                           *
+ ******************************************************************************/
+static inline void
+sample_field_grid(VectorFieldGrid * const grid,
+                  FieldEvaluator f,
+                  const void * const data,
+                  float time)
+{
+    /*  Step sizes in the three axes. Both ends of each axis are sampled.     */
+    const float dx = field_step(grid->width, grid->nx_pts);
+    const float dy = field_step(grid->height, grid->ny_pts);
+    const float dz = field_step(grid->depth, grid->nz_pts);
+
+    /*  Variables for indexing the three axes.                                */
+    unsigned int x_index, y_index, z_index;
+
+    /*  Pointer to the instance currently being written.                      */
+    float *instance = grid->instances;
+
+    /*  The point the field is evaluated at.                                  */
+    Vec3 position;
+
+    /*  Loop over the grid with x varying fastest, then y, then z.            */
+    for (z_index = 0U; z_index < grid->nz_pts; ++z_index)
+    {
+        position.z = grid->z_start + (float)(z_index) * dz;
+
+        for (y_index = 0U; y_index < grid->ny_pts; ++y_index)
+        {
+            position.y = grid->y_start + (float)(y_index) * dy;
+
+            for (x_index = 0U; x_index < grid->nx_pts; ++x_index)
+            {
+                position.x = grid->x_start + (float)(x_index) * dx;
+
+                write_arrow_instance(
+                    instance, position, f(data, position, time)
+                );
+
+                instance += VECTOR_FIELD_INSTANCE_SIZE;
+            }
+            /*  End of x-axis for-loop.                                       */
+        }
+        /*  End of y-axis for-loop.                                           */
+    }
+    /*  End of z-axis for-loop.                                               */
+}
+/*  End of sample_field_grid.                                                 */
+
+#endif
+/*  End of include guard.                                                     */
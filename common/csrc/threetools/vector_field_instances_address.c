@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Returns the address of the instance buffer of a vector field grid.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  VectorFieldGrid typedef found here.                                       */
+#include <threetools/types.h>
+
+/*  Function prototype / forward declaration found here.                      */
+#include <threetools/threetools.h>
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      vector_field_instances_address                                        *
+ *  Purpose:                                                                  *
+ *      Returns a pointer to the instance buffer of a vector field grid.      *
+ *  Arguments:                                                                *
+ *      grid (const VectorFieldGrid * const):                                 *
+ *          The grid containing the instance buffer that we want.             *
+ *  Output:                                                                   *
+ *      instances (float *):                                                  *
+ *          A pointer to the instance buffer.                                 *
+ *  Notes:                                                                    *
+ *      This function is called at the JavaScript level to get the address of *
+ *      the buffer that the InstancedMesh from vectorFieldArrows renders from.*
+ ******************************************************************************/
+float *vector_field_instances_address(const VectorFieldGrid * const grid)
+{
+    return grid->instances;
+}
+/*  End of vector_field_instances_address.                                    */
@@ -27,6 +27,13 @@
 /*  Function prototype / forward declaration given here.                      */
 #include <threetools/threetools.h>
 
+/*  PROFILE_START and PROFILE_STOP, which time the kernel, provided here.     */
+#include <threetools/profile.h>
+
+/*  Constants for keeping the total angle of rotation in [-pi, pi].           */
+#define ONE_PI (+3.141592653589793E+00F)
+#define TWO_PI (+6.283185307179586E+00F)
+
 /******************************************************************************
  *  Function:                                                                 *
  *      z_rotate_canvas                                                       *
@@ -37,12 +44,61 @@
  *          The canvas for the animation. This contains geometry and buffers. *
  *  Output:                                                                   *
  *      None (void).                                                          *
+ *  Notes:                                                                    *
+ *      Canvases with absolute rotations add rotation_angle to their total    *
+ *      angle and recompute the output buffer from the unmodified mesh. There *
+ *      is no accumulated rounding error, the mesh never drifts. Incremental  *
+ *      rotations rotate the mesh in place, and track the angle as well.      *
+ *      Normals, if the canvas has any, are rotated along with the mesh.      *
  ******************************************************************************/
 void z_rotate_canvas(Canvas * const canvas)
 {
+    /*  The rotation and the normals are timed along with the rest.           */
+    PROFILE_START;
+
     /*  This function is for use at the JavaScript and Godot level so that we *
-     *  may rotate the main canvas without passing any parameters. Pass the   *
-     *  global variables to the rotation function.                            */
-    rotate_mesh(canvas, rotation_vector);
+     *  may rotate the main canvas without passing any parameters. The global *
+     *  variables are passed to the rotation functions.                       */
+
+    /*  Keep the total angle in [-pi, pi]. Without this, a long-running       *
+     *  animation would slowly lose precision in the angle itself. The angle  *
+     *  is tracked for incremental rotations too, update_canvas uses it to    *
+     *  tell if the mesh has been rotated.                                    */
+    canvas->angle += rotation_angle;
+
+    if (canvas->angle > ONE_PI)
+        canvas->angle -= TWO_PI;
+
+    else if (canvas->angle < -ONE_PI)
+        canvas->angle += TWO_PI;
+
+    /*  Incremental rotations update the mesh in place. Absolute rotations    *
+     *  compute the output from the angle below.                              */
+    if (canvas->rotation_mode == IncrementalRotation)
+        rotate_mesh(canvas, rotation_vector);
+
+    /*  Bring the output buffer, which is what is rendered, up to date.       */
+    update_output_buffer(canvas);
+
+    /*  A rotation turns the normals the same way as the points. Incremental  *
+     *  rotations rotate them in place, which is cheaper than recomputing     *
+     *  them. Absolute rotations recompute them from the output, so they do   *
+     *  not drift either.                                                     */
+    if (canvas->normals)
+    {
+        if (canvas->rotation_mode == IncrementalRotation)
+            rotate_interleaved_buffer(
+                canvas->normals, canvas->number_of_points, rotation_vector
+            );
+
+        else
+            compute_canvas_normals(canvas);
+    }
+
+    PROFILE_STOP(ZRotateKernel, canvas->number_of_points);
 }
 /*  End of z_rotate_canvas.                                                   */
+
+/*  Undefine everything in case someone wants to #include this file.          */
+#undef ONE_PI
+#undef TWO_PI
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Renders a frame of a straight-line homotopy between two canvases.     *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {initGeometry} from "./initGeometry.js";
+import {checkMemoryViews} from "./memoryViews.js";
+import {homotopyCanvas, outputBufferAddress} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      canvasHomotopy                                                        *
+ *  Purpose:                                                                  *
+ *      Blends the meshes of two canvases in WebAssembly and renders the      *
+ *      scene.                                                                *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGLRenderer):                                       *
+ *          The renderer for the animation.                                   *
+ *      scene (three.Scene):                                                  *
+ *          The scene containing the surface.                                 *
+ *      camera (three.PerspectiveCamera):                                     *
+ *          The camera used for viewing the animation.                        *
+ *      surface (three.Object3D):                                             *
+ *          The object being rendered, with a geometry from                   *
+ *          canvasWireframeGeometry. Its canvas holds the start mesh.         *
+ *      target (Number):                                                      *
+ *          The address of the canvas holding the end mesh, from createCanvas.*
+ *          It must have the same grid and layout.                            *
+ *      t (Number):                                                           *
+ *          The time parameter, between 0 and 1.                              *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Neither mesh is modified, they are computed once and only the output  *
+ *      buffer is written to on each frame. The first call gives the start    *
+ *      canvas its own output buffer if it needs one, which moves the vertices*
+ *      the geometry is viewing.                                              *
+ ******************************************************************************/
+export function canvasHomotopy(renderer, scene, camera, surface, target, t) {
+
+    const canvas = surface.geometry.userData.canvas;
+    homotopyCanvas(canvas, target, t);
+
+    /*  Re-create the views in place if the memory grew, see memoryViews.js.  */
+    checkMemoryViews();
+
+    /*  The output buffer may have moved, for example when the canvas gets an *
+     *  output buffer of its own, in which case the views need to be          *
+     *  re-created. Memory growth alone was handled above.                    */
+    const positions = surface.geometry.attributes.position.array;
+
+    if (positions.byteOffset != outputBufferAddress(canvas)) {
+        const meshSize = surface.geometry.attributes.position.count * 3;
+        const indexSize = surface.geometry.index.count;
+        initGeometry(surface.geometry, meshSize, indexSize);
+    }
+
+    /*  The normals, if any, were recomputed for the blended mesh.            */
+    if (surface.geometry.attributes.normal) {
+        surface.geometry.attributes.normal.needsUpdate = true;
+    }
+
+    /*  The colors, if any, were recomputed from the heights of the blend.    */
+    if (surface.geometry.attributes.color) {
+        surface.geometry.attributes.color.needsUpdate = true;
+    }
+
+    /*  Re-render the scene with the blended mesh.                            */
+    surface.geometry.attributes.position.needsUpdate = true;
+    renderer.render(scene, camera);
+}
+/*  End of canvasHomotopy.                                                    */
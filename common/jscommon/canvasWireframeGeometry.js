@@ -0,0 +1,50 @@
+import {BufferGeometry} from 'three';
+import {initGeometry} from './initGeometry.js';
+import {wireframeSizes} from './wireframeSizes.js';
+import {
+    createCanvas,
+    MeshLayout,
+    RotationMode,
+    setupCanvasMesh
+} from 'wasmtools';
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      canvasWireframeGeometry                                               *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe geometry backed by its own canvas, so that *
+ *      several surfaces may be rendered by one module.                       *
+ *  Arguments:                                                                *
+ *      parameters (Object):                                                  *
+ *          The canvas parameters: nxPts, nyPts, width, height, xStart,       *
+ *          yStart, and optionally meshLayout and rotationMode.               *
+ *  Output:                                                                   *
+ *      geometry (BufferGeometry):                                            *
+ *          The geometry. The address of its canvas is stored in              *
+ *          geometry.userData.canvas.                                         *
+ *  Notes:                                                                    *
+ *      The canvas is not freed with the geometry. Call destroyCanvas on      *
+ *      geometry.userData.canvas once the geometry is disposed.               *
+ ******************************************************************************/
+export function canvasWireframeGeometry(parameters) {
+
+    /*  Same sizes as in squareWireframeGeometry.                             */
+    const geometry = new BufferGeometry();
+    const {meshSize, indexSize} = wireframeSizes(parameters);
+
+    /*  The vertices are stored interleaved and rotated in place, unless a    *
+     *  different layout or rotation mode is requested.                       */
+    const canvasParameters = {
+        meshLayout: MeshLayout.InterleavedLayout,
+        rotationMode: RotationMode.IncrementalRotation,
+        ...parameters
+    };
+
+    /*  Allocate a canvas for this surface and compute the mesh in it.        */
+    geometry.userData.canvas = createCanvas(canvasParameters);
+    setupCanvasMesh(geometry.userData.canvas);
+    initGeometry(geometry, meshSize, indexSize);
+
+    return geometry;
+}
+/*  End of canvasWireframeGeometry.                                           */
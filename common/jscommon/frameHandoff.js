@@ -0,0 +1,44 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Layout of the shared control block used to pass frames between a mesh *
+ *      worker and the main thread.                                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The worker computes a frame into one output buffer while the main thread  *
+ *  renders from the other. The control block is an Int32Array on a           *
+ *  SharedArrayBuffer with two entries. The state says whether a new frame is *
+ *  waiting, and the buffer says which of the two output buffers holds it.    *
+ *  Only the worker blocks, using Atomics.wait, the main thread never does.   */
+export const FrameHandoff = Object.freeze({
+
+    /*  Indices into the control block, and the number of entries.            */
+    stateIndex: 0,
+    bufferIndex: 1,
+    length: 2,
+
+    /*  The main thread took the last frame, the worker may write the next.   */
+    consumed: 0,
+
+    /*  A new frame is ready, the worker waits until it has been taken.       */
+    ready: 1
+});
@@ -0,0 +1,94 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the next band of rows of a progressive wireframe geometry.   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {generateCanvasBand} from "wasmtools";
+import {checkMemoryViews} from "./memoryViews.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      generateWireframeBand                                                 *
+ *  Purpose:                                                                  *
+ *      Computes the next band of rows of a geometry from                     *
+ *      progressiveWireframeGeometry, uploads the rows that were computed, and*
+ *      draws the line segments that are ready.                               *
+ *  Arguments:                                                                *
+ *      geometry (BufferGeometry):                                            *
+ *          The geometry being generated.                                     *
+ *  Output:                                                                   *
+ *      done (Boolean):                                                       *
+ *          True once the whole mesh has been computed.                       *
+ *  Notes:                                                                    *
+ *      The WebAssembly memory does not grow while generating the bands, every*
+ *      buffer was allocated by progressiveWireframeGeometry, so the views    *
+ *      stay valid. Only the new rows are uploaded. The index buffer is       *
+ *      computed in full with the first band and uploaded as the segments     *
+ *      become drawable.                                                      *
+ ******************************************************************************/
+export function generateWireframeBand(geometry) {
+
+    const {canvas, bandRows, nextRow} = geometry.userData;
+
+    /*  Nothing left to do once the last band is done.                        */
+    if (geometry.userData.done) {
+        return true;
+    }
+
+    const band = generateCanvasBand(canvas, nextRow, bandRows);
+
+    /*  Re-create the views in place if the memory grew, see memoryViews.js.  */
+    checkMemoryViews();
+    const position = geometry.attributes.position;
+
+    if (band.outputCount > 0) {
+        position.addUpdateRange(band.outputStart, band.outputCount);
+        position.needsUpdate = true;
+    }
+
+    if (band.indexCount > 0) {
+        geometry.index.addUpdateRange(band.indexStart, band.indexCount);
+        geometry.index.needsUpdate = true;
+    }
+
+    /*  Every segment before the end of the index range may now be drawn.     */
+    geometry.setDrawRange(0, band.indexStart + band.indexCount);
+
+    /*  Colors are computed with the vertices, normals with the last band.    */
+    if (geometry.attributes.color) {
+        geometry.attributes.color.needsUpdate = true;
+    }
+
+    if (band.done) {
+        if (geometry.attributes.normal) {
+            geometry.attributes.normal.needsUpdate = true;
+        }
+
+        geometry.computeBoundingSphere();
+    }
+
+    geometry.userData.nextRow = band.endRow;
+    geometry.userData.done = band.done;
+    return band.done;
+}
+/*  End of generateWireframeBand.                                             */
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rotates an object about the z axis on the GPU, through its model      *
+ *      matrix, instead of rewriting the vertices on the CPU.                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Full turn, used to keep the accumulated angle small.                      */
+const TWO_PI = 2.0 * Math.PI;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      gpuZRotate                                                            *
+ *  Purpose:                                                                  *
+ *      Rotates the surface slowly about the z axis and renders the scene.    *
+ *      Unlike zRotate, the vertex buffer is never modified, so nothing is    *
+ *      re-uploaded to the GPU.                                               *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGLRenderer):                                       *
+ *          The renderer for the animation.                                   *
+ *      scene (three.Scene):                                                  *
+ *          The scene containing the surface.                                 *
+ *      camera (three.PerspectiveCamera):                                     *
+ *          The camera used for viewing the animation.                        *
+ *      surface (three.Object3D):                                             *
+ *          The object being rotated, usually a LineSegments wireframe.       *
+ *      angle (Number):                                                       *
+ *          The angle of rotation between frames.                             *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      The rotation is applied by the vertex shader through the model matrix.*
+ *      Only sixteen floats change per frame, regardless of the size of the   *
+ *      mesh.                                                                 *
+ ******************************************************************************/
+export function gpuZRotate(renderer, scene, camera, surface, angle) {
+
+    /*  Accumulate the total angle, keeping it below 2 pi in magnitude. The   *
+     *  mesh itself is untouched, so there is no drift in the geometry either.*/
+    surface.rotation.z = (surface.rotation.z + angle) % TWO_PI;
+
+    /*  Re-render the newly rotated scene. No attribute needs an update.      */
+    renderer.render(scene, camera);
+}
+/*  End of gpuZRotate.                                                        */
@@ -24,13 +24,36 @@
  ******************************************************************************/
 import Stats from "three/examples/jsm/libs/stats.module.js";
 export {basicWireframe} from "./basicWireframe.js";
+export {canvasHomotopy} from "./canvasHomotopy.js";
+export {canvasWireframeGeometry} from "./canvasWireframeGeometry.js";
+export {generateWireframeBand} from "./generateWireframeBand.js";
+export {gpuZRotate} from "./gpuZRotate.js";
 export {initGeometry} from "./initGeometry.js";
+export {lodWireframeGeometries} from "./lodWireframeGeometries.js";
+export {
+    checkMemoryViews,
+    refreshMemoryViews,
+    trackMemoryViews,
+    untrackMemoryViews
+} from "./memoryViews.js";
+export {profileOverlay} from "./profileOverlay.js";
+export {progressiveWireframeGeometry} from "./progressiveWireframeGeometry.js";
 export {sceneCamera} from "./sceneCamera.js";
 export {sceneFromSurface} from "./sceneFromSurface.js";
 export {sceneRenderer} from "./sceneRenderer.js";
+export {selectLevelOfDetail} from "./selectLevelOfDetail.js";
 export {setupControls} from "./setupControls.js";
 export {squareWireframeGeometry} from "./squareWireframeGeometry.js";
+export {transformWireframeGeometry} from "./transformWireframeGeometry.js";
+export {updateVectorFieldArrows} from "./updateVectorFieldArrows.js";
+export {updateWireframeGeometry} from "./updateWireframeGeometry.js";
+export {vectorFieldArrows} from "./vectorFieldArrows.js";
+/*  The other WebGPU functions are in webgpu.js, bundled separately.          */
+export {webgpuAvailable} from "./webgpuAvailable.js";
 export {windowResize} from "./windowResize.js";
+export {wireframeSizes} from "./wireframeSizes.js";
+export {workerWireframeGeometry} from "./workerWireframeGeometry.js";
+export {workerZRotate} from "./workerZRotate.js";
 export {zRotate} from "./zRotate.js";
 export * from 'wasmtools';
 export {Stats};
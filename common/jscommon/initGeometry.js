@@ -1,24 +1,72 @@
 import {BufferAttribute} from 'three';
+import {trackMemoryViews} from "./memoryViews.js";
 import {
+    colorBufferAddress,
     mainCanvasAddress,
     indexBufferAddress,
-    meshBufferAddress,
+    indexBufferType,
+    IndexType,
+    normalBufferAddress,
+    outputBufferAddress,
     memory
 } from "wasmtools";
 
-/*  Helper function for initializing the three.js geometry.                   */
+/*  Helper function for initializing the three.js geometry. The vertices are  *
+ *  read from the output buffer, which is always interleaved. For planar      *
+ *  meshes this is the packed copy, otherwise it is the mesh buffer itself.   *
+ *  The buffers come from the canvas stored in the geometry's userData, or    *
+ *  the main canvas if there is none. Canvases with a normal buffer, see      *
+ *  resetNormalBuffer, also get a normal attribute, and canvases with a color *
+ *  map, see setCanvasColorMap, get a color attribute. The material needs     *
+ *  vertexColors set to true to use the colors.                               */
 export function initGeometry(geometry, meshSize, indexSize) {
 
-    const canvasPtr = mainCanvasAddress();
-    const meshPtr = meshBufferAddress(canvasPtr);
+    const canvasPtr = geometry.userData.canvas ?? mainCanvasAddress();
+    const meshPtr = outputBufferAddress(canvasPtr);
     const indexPtr = indexBufferAddress(canvasPtr);
 
     const meshBuffer = new Float32Array(memory.buffer, meshPtr, meshSize);
-    const indexBuffer = new Uint32Array(memory.buffer, indexPtr, indexSize);
+
+    /*  Meshes with few enough vertices use 16-bit indices, check which.      */
+    const IndexArray = indexBufferType(canvasPtr) === IndexType.Uint16Indices ?
+        Uint16Array : Uint32Array;
+
+    const indexBuffer = new IndexArray(memory.buffer, indexPtr, indexSize);
 
     const geometryAttributes = new BufferAttribute(meshBuffer, 3);
     const indexAttribute = new BufferAttribute(indexBuffer, 1);
 
     geometry.setAttribute('position', geometryAttributes);
     geometry.setIndex(indexAttribute);
+
+    /*  The normals are interleaved and have the same size as the vertices.   */
+    const normalPtr = normalBufferAddress(canvasPtr);
+
+    if (normalPtr) {
+        const normals = new Float32Array(memory.buffer, normalPtr, meshSize);
+        geometry.setAttribute('normal', new BufferAttribute(normals, 3));
+    }
+
+    /*  The colors are packed RGB bytes, one color per point. They are        *
+     *  normalized, so the shader sees values between 0 and 1.                */
+    const colorPtr = colorBufferAddress(canvasPtr);
+
+    if (colorPtr) {
+        const colors = new Uint8Array(memory.buffer, colorPtr, meshSize);
+        geometry.setAttribute('color', new BufferAttribute(colors, 3, true));
+    }
+
+    /*  Every attribute is a view into the WebAssembly memory. They are       *
+     *  re-created in place if the memory grows, see memoryViews.js.          */
+    const views = [geometry.attributes.position, geometry.index];
+
+    if (geometry.attributes.normal) {
+        views.push(geometry.attributes.normal);
+    }
+
+    if (geometry.attributes.color) {
+        views.push(geometry.attributes.color);
+    }
+
+    trackMemoryViews(geometry, views);
 }
@@ -0,0 +1,118 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates the wireframe geometries for a level-of-detail pyramid.       *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {BufferGeometry} from "three";
+import {initGeometry} from "./initGeometry.js";
+import {wireframeSizes} from "./wireframeSizes.js";
+import {
+    canvasPyramidLevel,
+    createCanvasPyramid,
+    MeshLayout,
+    RotationMode,
+    setupPyramidMesh
+} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      levelPoints                                                           *
+ *  Purpose:                                                                  *
+ *      Computes the number of points along one axis of a level, the same as  *
+ *      pyramid_level_points in threetools/pyramid.h.                         *
+ *  Arguments:                                                                *
+ *      points (Number):                                                      *
+ *          The number of points along the axis of the full grid.             *
+ *      level (Number):                                                       *
+ *          The level, zero for the full grid.                                *
+ *  Output:                                                                   *
+ *      levelPoints (Number):                                                 *
+ *          The points along the axis, halved once per level, but no fewer    *
+ *          than two.                                                         *
+ ******************************************************************************/
+function levelPoints(points, level) {
+    return points < 2 ? points : Math.max(points >> level, 2);
+}
+/*  End of levelPoints.                                                       */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      lodWireframeGeometries                                                *
+ *  Purpose:                                                                  *
+ *      Creates square wireframes for a surface at several levels of detail,  *
+ *      each level with half as many points along each axis as the one before.*
+ *  Arguments:                                                                *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters for the full grid: nxPts, nyPts, width,     *
+ *          height, xStart, yStart, and optionally meshLayout and             *
+ *          rotationMode.                                                     *
+ *      numberOfLevels (Number):                                              *
+ *          The number of levels, four by default, giving 512, 256, 128, and  *
+ *          64 points for a 512 x 512 grid. Small grids may get fewer.        *
+ *  Output:                                                                   *
+ *      lod (struct):                                                         *
+ *          The pyramid address, the geometries, finest first, and the index  *
+ *          of the level in use, see selectLevelOfDetail.                     *
+ *  Notes:                                                                    *
+ *      The mesh is computed once, in WebAssembly, and is best rotated with   *
+ *      gpuZRotate. zRotate works too, selectLevelOfDetail rotates a level to *
+ *      the angle of the previous one when it is swapped in. Each geometry    *
+ *      has its canvas in userData.canvas. These live in the pyramid and are  *
+ *      freed with destroyCanvasPyramid(lod.pyramid), once the geometries are *
+ *      disposed.                                                             *
+ ******************************************************************************/
+export function lodWireframeGeometries(parameters, numberOfLevels = 4) {
+
+    /*  Every level is stored interleaved, the same as in                     *
+     *  canvasWireframeGeometry.                                              */
+    const canvasParameters = {
+        meshLayout: MeshLayout.InterleavedLayout,
+        rotationMode: RotationMode.IncrementalRotation,
+        ...parameters
+    };
+
+    /*  Compute the mesh and the line segments for every level at once.       */
+    const pyramid = createCanvasPyramid(canvasParameters, numberOfLevels);
+    setupPyramidMesh(pyramid);
+
+    const geometries = [];
+
+    /*  canvasPyramidLevel returns zero past the last level.                  */
+    for (let level = 0; canvasPyramidLevel(pyramid, level); ++level) {
+
+        /*  Same sizes as in squareWireframeGeometry, for this level.         */
+        const {meshSize, indexSize} = wireframeSizes({
+            ...canvasParameters,
+            nxPts: levelPoints(parameters.nxPts, level),
+            nyPts: levelPoints(parameters.nyPts, level)
+        });
+
+        const geometry = new BufferGeometry();
+        geometry.userData.canvas = canvasPyramidLevel(pyramid, level);
+        initGeometry(geometry, meshSize, indexSize);
+        geometries.push(geometry);
+    }
+
+    return {pyramid: pyramid, geometries: geometries, level: 0};
+}
+/*  End of lodWireframeGeometries.                                            */
@@ -0,0 +1,165 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Keeps views into the WebAssembly memory valid after the memory grows. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+import {addMemoryGrowthListener, memory} from "wasmtools";
+
+/*  The tracked views, by owner. Each owner, usually a geometry, has a list   *
+ *  of targets, the attributes or buffers whose array is a view into the      *
+ *  memory, along with where the view is. Detached views have a length and    *
+ *  offset of zero, so these are recorded while the view is still valid.      */
+const trackedViews = new Map();
+
+/*  The buffer the tracked views were last created over. Allocations made     *
+ *  outside of libthreetools, for example by embind, grow the memory without  *
+ *  a call to check_memory_growth, see checkMemoryViews.                      */
+let viewedBuffer = null;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      untrackOnDispose                                                      *
+ *  Purpose:                                                                  *
+ *      Stops tracking the views of a geometry when it is disposed.           *
+ *  Arguments:                                                                *
+ *      event (Object):                                                       *
+ *          The dispose event, whose target is the geometry.                  *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ ******************************************************************************/
+function untrackOnDispose(event) {
+    trackedViews.delete(event.target);
+}
+/*  End of untrackOnDispose.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      trackMemoryViews                                                      *
+ *  Purpose:                                                                  *
+ *      Records views into the WebAssembly memory so that they are re-created *
+ *      when the memory grows.                                                *
+ *  Arguments:                                                                *
+ *      owner (Object):                                                       *
+ *          The object the views belong to, like a three.BufferGeometry.      *
+ *          Tracking the same owner again replaces its views.                 *
+ *      targets (Array):                                                      *
+ *          The three.BufferAttribute or three.InterleavedBuffer objects whose*
+ *          arrays are views into the memory.                                 *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Owners with an event dispatcher, like geometries, are untracked when  *
+ *      they are disposed. Others are untracked with untrackMemoryViews.      *
+ ******************************************************************************/
+export function trackMemoryViews(owner, targets) {
+
+    const views = targets.map((target) => ({
+        target: target,
+        ArrayType: target.array.constructor,
+        byteOffset: target.array.byteOffset,
+        length: target.array.length
+    }));
+
+    trackedViews.set(owner, views);
+
+    /*  The views were just created, so they are over the current buffer.     */
+    viewedBuffer = memory.buffer;
+
+    /*  three.js ignores listeners that have already been added.              */
+    if (owner.addEventListener) {
+        owner.addEventListener("dispose", untrackOnDispose);
+    }
+}
+/*  End of trackMemoryViews.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      untrackMemoryViews                                                    *
+ *  Purpose:                                                                  *
+ *      Stops tracking the views of an owner.                                 *
+ *  Arguments:                                                                *
+ *      owner (Object):                                                       *
+ *          The owner passed to trackMemoryViews.                             *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ ******************************************************************************/
+export function untrackMemoryViews(owner) {
+    trackedViews.delete(owner);
+}
+/*  End of untrackMemoryViews.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      refreshMemoryViews                                                    *
+ *  Purpose:                                                                  *
+ *      Re-creates every tracked view over the current memory buffer.         *
+ *  Arguments:                                                                *
+ *      None.                                                                 *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      This is called automatically when libthreetools reports that the      *
+ *      memory grew. Growth moves none of the buffers, so each view is        *
+ *      re-created at the same offset and length, and nothing is copied. The  *
+ *      GPU buffers keep their size, the data is only uploaded again.         *
+ ******************************************************************************/
+export function refreshMemoryViews() {
+
+    const buffer = memory.buffer;
+    viewedBuffer = buffer;
+
+    for (const views of trackedViews.values()) {
+        for (const view of views) {
+            view.target.array =
+                new view.ArrayType(buffer, view.byteOffset, view.length);
+
+            view.target.needsUpdate = true;
+        }
+    }
+}
+/*  End of refreshMemoryViews.                                                */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      checkMemoryViews                                                      *
+ *  Purpose:                                                                  *
+ *      Re-creates the tracked views if the memory buffer was replaced since  *
+ *      they were created.                                                    *
+ *  Arguments:                                                                *
+ *      None.                                                                 *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      check_memory_growth only sees the allocations of libthreetools. This  *
+ *      also catches the rest, like the strings and objects embind allocates, *
+ *      at the cost of comparing one reference. The functions in jscommon     *
+ *      that use the views call this first.                                   *
+ ******************************************************************************/
+export function checkMemoryViews() {
+    if (memory.buffer !== viewedBuffer) {
+        refreshMemoryViews();
+    }
+}
+/*  End of checkMemoryViews.                                                  */
+
+/*  Refresh the views as soon as libthreetools sees the memory grow.          */
+addMemoryGrowthListener(refreshMemoryViews);
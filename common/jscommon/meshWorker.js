@@ -0,0 +1,108 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Body of the worker that owns the WebAssembly module for               *
+ *      workerWireframeGeometry.                                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      meshWorker                                                            *
+ *  Purpose:                                                                  *
+ *      Computes the frames of a rotating wireframe, one frame ahead of the   *
+ *      main thread.                                                          *
+ *  Arguments:                                                                *
+ *      handoff (Object):                                                     *
+ *          The FrameHandoff constants, the layout of the control block.      *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      This is run inside the worker. It is converted to a string by         *
+ *      workerWireframeGeometry, so it must not refer to anything outside of  *
+ *      itself. The first message has the URL of the threaded emscripten      *
+ *      module, the canvas parameters as plain numbers, the rotation angle,   *
+ *      and the control block. The mesh, indices, and both output buffers are *
+ *      allocated before the memory is shared with the main thread, and       *
+ *      nothing is allocated afterwards.                                      *
+ ******************************************************************************/
+export function meshWorker(handoff) {
+
+    self.onmessage = async function(event) {
+
+        const {moduleURL, parameters, rotationAngle, control} = event.data;
+
+        /*  The threaded build has shared memory, which the main thread can   *
+         *  view directly. Load it here, the worker owns the module.          */
+        const initModule = (await import(moduleURL)).default;
+        const module = await initModule();
+
+        /*  embind enums do not survive postMessage, they are sent as their   *
+         *  numeric values and converted back here. Absolute rotations write  *
+         *  each frame to the output buffer from the untouched mesh, which is *
+         *  what lets the two output buffers take turns.                      */
+        const canvasParameters = {
+            ...parameters,
+            meshType: module.MeshType.values[parameters.meshType],
+            meshLayout: module.MeshLayout.values[parameters.meshLayout],
+            rotationMode: module.RotationMode.AbsoluteRotation
+        };
+
+        const canvas = module.createCanvas(canvasParameters);
+        module.setupCanvasMesh(canvas);
+        module.resetBackBuffer(canvas);
+        module.setRotationAngle(rotationAngle);
+
+        /*  The first frame is in the output buffer, computed by              *
+         *  setupCanvasMesh. Hand it over with everything the main thread     *
+         *  needs to create its views.                                        */
+        const outputs = [
+            module.outputBufferAddress(canvas),
+            module.backBufferAddress(canvas)
+        ];
+
+        self.postMessage({
+            buffer: module.HEAP8.buffer,
+            outputs: outputs,
+            indices: module.indexBufferAddress(canvas),
+            indexType: module.indexBufferType(canvas).value
+        });
+
+        let current = 0;
+        Atomics.store(control, handoff.bufferIndex, current);
+        Atomics.store(control, handoff.stateIndex, handoff.ready);
+
+        /*  The worker never returns to its event loop, it is stopped with    *
+         *  terminate. Wait for the main thread to take the last frame, then  *
+         *  write the next one into the other buffer.                         */
+        while (true) {
+            Atomics.wait(control, handoff.stateIndex, handoff.ready);
+
+            module.swapOutputBuffers(canvas);
+            module.zRotateCanvas(canvas);
+            current = 1 - current;
+
+            Atomics.store(control, handoff.bufferIndex, current);
+            Atomics.store(control, handoff.stateIndex, handoff.ready);
+        }
+    };
+}
+/*  End of meshWorker.                                                        */
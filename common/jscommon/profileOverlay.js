@@ -0,0 +1,165 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Shows where the time in each frame goes, for the profiling build of an*
+ *      animation.                                                            *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {
+    getKernelCounter,
+    ProfileKernel,
+    profilingEnabled
+} from "wasmtools";
+
+/*  How often the overlay is redrawn, in milliseconds. The numbers are        *
+ *  averaged over this window, which keeps them readable.                     */
+const refreshInterval = 500.0;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      kernelSnapshot                                                        *
+ *  Purpose:                                                                  *
+ *      Reads the counters of every kernel.                                   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      snapshot (Array):                                                     *
+ *          The name and counters of each kernel, in the order of the         *
+ *          ProfileKernel enum.                                               *
+ ******************************************************************************/
+function kernelSnapshot() {
+
+    /*  embind enums have a values entry, the rest are the enum members.      */
+    return Object.keys(ProfileKernel)
+        .filter((name) => name !== "values")
+        .map((name) => ({
+            name: name,
+            counter: getKernelCounter(ProfileKernel[name])
+        }));
+}
+/*  End of kernelSnapshot.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      profileOverlay                                                        *
+ *  Purpose:                                                                  *
+ *      Adds an overlay to the page with the time per frame spent in          *
+ *      WebAssembly, in renderer.render, and in each of the kernels.          *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGLRenderer):                                       *
+ *          The renderer for the animation.                                   *
+ *  Output:                                                                   *
+ *      overlay (HTMLElement):                                                *
+ *          The element the numbers are written to, already added to the page.*
+ *  Notes:                                                                    *
+ *      renderer.render is wrapped so that it can be timed. This includes     *
+ *      uploading the attributes marked with needsUpdate, and submitting the  *
+ *      draw calls, but not the time the GPU spends drawing. The kernel timers*
+ *      need the profiling build, loaded by adding ?profile to the URL. The   *
+ *      counters are compared to the previous refresh, they are never reset   *
+ *      here, so resetKernelCounters can still be used elsewhere.             *
+ ******************************************************************************/
+export function profileOverlay(renderer) {
+
+    const overlay = document.createElement("pre");
+
+    overlay.style.position = "fixed";
+    overlay.style.top = "0px";
+    overlay.style.right = "0px";
+    overlay.style.margin = "0px";
+    overlay.style.padding = "4px";
+    overlay.style.font = "11px monospace";
+    overlay.style.color = "#00ff00";
+    overlay.style.background = "rgba(0, 0, 0, 0.7)";
+    overlay.style.pointerEvents = "none";
+    document.body.appendChild(overlay);
+
+    /*  Totals for the current window, and the kernels at its start.          */
+    let frames = 0;
+    let renderTime = 0.0;
+    let windowStart = performance.now();
+    let previous = kernelSnapshot();
+
+    /*  The time between frames is what the user sees. Whatever is not spent  *
+     *  in renderer.render is spent in the animation itself, mostly in        *
+     *  WebAssembly.                                                          */
+    const render = renderer.render.bind(renderer);
+
+    renderer.render = function(scene, camera) {
+        const start = performance.now();
+        render(scene, camera);
+        const end = performance.now();
+
+        frames += 1;
+        renderTime += end - start;
+
+        if (end - windowStart < refreshInterval) {
+            return;
+        }
+
+        const elapsed = end - windowStart;
+        const current = kernelSnapshot();
+        const lines = [
+            `frame   ${(elapsed / frames).toFixed(2)} ms`,
+            `render  ${(renderTime / frames).toFixed(2)} ms`
+        ];
+
+        if (!profilingEnabled()) {
+            lines.push("kernels not timed, reload with ?profile");
+        }
+
+        /*  Only the kernels that ran in this window are listed. The time is  *
+         *  per frame, and per point, to spot kernels that got slower.        */
+        else {
+            current.forEach((kernel, index) => {
+                const before = previous[index].counter;
+                const calls = kernel.counter.calls - before.calls;
+                const points = kernel.counter.points - before.points;
+                const nanoseconds =
+                    kernel.counter.nanoseconds - before.nanoseconds;
+
+                if (calls == 0) {
+                    return;
+                }
+
+                const perFrame = 1.0E-6 * nanoseconds / frames;
+                const perPoint = points > 0 ? nanoseconds / points : 0.0;
+                const name = kernel.name.replace("Kernel", "").padEnd(16);
+
+                lines.push(
+                    `${name}${perFrame.toFixed(3)} ms ` +
+                    `${perPoint.toFixed(2)} ns/pt`
+                );
+            });
+        }
+
+        overlay.textContent = lines.join("\n");
+
+        frames = 0;
+        renderTime = 0.0;
+        windowStart = end;
+        previous = current;
+    };
+
+    return overlay;
+}
+/*  End of profileOverlay.                                                    */
@@ -0,0 +1,86 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a wireframe geometry that is generated a band of rows at a    *
+ *      time.                                                                 *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {BufferGeometry, Sphere, Vector3} from "three";
+import {initGeometry} from "./initGeometry.js";
+import {wireframeSizes} from "./wireframeSizes.js";
+import {
+    createCanvas,
+    MeshLayout,
+    RotationMode
+} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      progressiveWireframeGeometry                                          *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe whose mesh has not been computed yet. The  *
+ *      mesh is computed a band of rows at a time by generateWireframeBand,   *
+ *      and the geometry draws what is ready.                                 *
+ *  Arguments:                                                                *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters: nxPts, nyPts, width, height, xStart,       *
+ *          yStart, and optionally meshLayout and rotationMode.               *
+ *      bandRows (Number):                                                    *
+ *          The number of rows computed per band, 64 by default.              *
+ *  Output:                                                                   *
+ *      geometry (BufferGeometry):                                            *
+ *          The geometry, with nothing drawn. The canvas and the progress are *
+ *          stored in geometry.userData.                                      *
+ *  Notes:                                                                    *
+ *      Call generateWireframeBand once per frame until it returns true. The  *
+ *      first frame is drawn after one band rather than the whole mesh. The   *
+ *      canvas is not freed with the geometry, call destroyCanvas on          *
+ *      geometry.userData.canvas once the geometry is disposed.               *
+ ******************************************************************************/
+export function progressiveWireframeGeometry(parameters, bandRows = 64) {
+
+    /*  Same sizes as in squareWireframeGeometry.                             */
+    const geometry = new BufferGeometry();
+    const {meshSize, indexSize} = wireframeSizes(parameters);
+
+    /*  Same defaults as canvasWireframeGeometry.                             */
+    const canvasParameters = {
+        meshLayout: MeshLayout.InterleavedLayout,
+        rotationMode: RotationMode.IncrementalRotation,
+        ...parameters
+    };
+
+    /*  The buffers are allocated, but nothing is computed until the first    *
+     *  band, and nothing is drawn until then either. The rows not yet        *
+     *  computed hold whatever was in memory, so the bounding sphere can not  *
+     *  be computed from them. Never cull the geometry until it is done.      */
+    geometry.userData.canvas = createCanvas(canvasParameters);
+    geometry.userData.bandRows = bandRows;
+    geometry.userData.nextRow = 0;
+    geometry.userData.done = false;
+    initGeometry(geometry, meshSize, indexSize);
+    geometry.setDrawRange(0, 0);
+    geometry.boundingSphere = new Sphere(new Vector3(), Infinity);
+
+    return geometry;
+}
+/*  End of progressiveWireframeGeometry.                                      */
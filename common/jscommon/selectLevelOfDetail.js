@@ -0,0 +1,99 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Swaps the geometry of a surface for the level of detail matching the  *
+ *      camera.                                                               *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+import {matchCanvasRotation} from "wasmtools";
+import {checkMemoryViews} from "./memoryViews.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      selectLevelOfDetail                                                   *
+ *  Purpose:                                                                  *
+ *      Picks the level of detail for a surface from the distance between the *
+ *      camera and the target of the controls, and swaps the geometry if it   *
+ *      changed.                                                              *
+ *  Arguments:                                                                *
+ *      surface (three.Object3D):                                             *
+ *          The object being drawn, with a geometry from                      *
+ *          lodWireframeGeometries.                                           *
+ *      lod (struct):                                                         *
+ *          The levels of detail, from lodWireframeGeometries.                *
+ *      camera (three.PerspectiveCamera):                                     *
+ *          The camera used for viewing the animation.                        *
+ *      controls (OrbitControls):                                             *
+ *          The controls returned by setupControls. The distance is measured  *
+ *          to their target.                                                  *
+ *      fullDetailDistance (Number):                                          *
+ *          The distance at which, and below which, the full grid is drawn.   *
+ *          Usually the distance of the starting camera position.             *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Each doubling of the distance halves the size of the surface on the   *
+ *      screen, so it drops one level, which halves the points along each     *
+ *      axis. The spacing of the lines in pixels stays about the same. This is*
+ *      cheap and may be called every frame, the geometry is only swapped when*
+ *      the level changes. zRotate only rotates the canvas of the level being *
+ *      drawn, so the new level is first rotated to the angle of the old one. *
+ *      Figures using gpuZRotate never rotate the canvases, and nothing is    *
+ *      rotated or uploaded for these.                                        *
+ ******************************************************************************/
+export function selectLevelOfDetail(
+    surface, lod, camera, controls, fullDetailDistance
+) {
+
+    const distance = camera.position.distanceTo(controls.target);
+    const lastLevel = lod.geometries.length - 1;
+
+    /*  One level per doubling of the distance, clamped to the pyramid.       */
+    const ratio = Math.log2(distance / fullDetailDistance);
+    const level = Math.min(Math.max(Math.floor(ratio), 0), lastLevel);
+
+    if (level === lod.level) {
+        return;
+    }
+
+    const outgoing = lod.geometries[lod.level].userData.canvas;
+    const incoming = lod.geometries[level];
+
+    /*  Levels that were not drawn missed the rotations of the one that was.  *
+     *  Catch up, uploading the rotated vertices, if the angles differ.       */
+    if (matchCanvasRotation(incoming.userData.canvas, outgoing)) {
+        incoming.attributes.position.needsUpdate = true;
+
+        if (incoming.attributes.normal) {
+            incoming.attributes.normal.needsUpdate = true;
+        }
+    }
+
+    /*  The incoming level may not have been drawn since the memory grew.     */
+    checkMemoryViews();
+
+    /*  The geometries share nothing, and apart from the rotation swapping    *
+     *  them needs no upload. Each one was uploaded to the GPU the first time *
+     *  it was drawn.                                                         */
+    surface.geometry = incoming;
+    lod.level = level;
+}
+/*  End of selectLevelOfDetail.                                               */
@@ -37,10 +37,9 @@ import {OrbitControls} from 'three/addons/controls/OrbitControls.js';
  *      camera (three.PerspectiveCamera):                                     *
  *          The camera used for viewing the animation.                        *
  *  Output:                                                                   *
- *      None.                                                                 *
- *  Notes:                                                                    *
- *      The controls are added to the renderer. We do not need to return the  *
- *      controls back to the caller, so this function has no return.          *
+ *      controls (OrbitControls):                                             *
+ *          The controls, attached to the renderer. Most animations can       *
+ *          ignore these, selectLevelOfDetail uses their target.              *
  ******************************************************************************/
 export function setupControls(renderer, camera) {
 
@@ -49,5 +48,7 @@ export function setupControls(renderer, camera) {
     const controls = new OrbitControls(camera, renderer.domElement);
     controls.target.set(0.0, 0.0, 0.0);
     controls.update();
+
+    return controls;
 }
 /*  End of setupControls.                                                     */
@@ -1,6 +1,7 @@
 import {BufferGeometry} from 'three';
 import {initGeometry} from './initGeometry.js';
-import {setupMesh} from 'wasmtools';
+import {wireframeSizes} from './wireframeSizes.js';
+import {MeshLayout, RotationMode, setupMesh} from 'wasmtools';
 
 /******************************************************************************
  *  Function:                                                                 *
@@ -19,13 +20,20 @@ export function squareWireframeGeometry(parameters) {
      *  with diagonals across the squares, creating a mesh of triangles. To   *
      *  see a square pattern we need to use our own buffer.                   */
     const geometry = new BufferGeometry();
-    const product = parameters.nxPts * parameters.nyPts;
-    const sum = parameters.nxPts + parameters.nyPts - 1;
-    const meshSize = 3 * product;
-    const indexSize = 2 * (2 * product - sum - 1);
+
+    /*  The number of line segments depends on the mesh type.                 */
+    const {meshSize, indexSize} = wireframeSizes(parameters);
+
+    /*  The vertices are stored interleaved and rotated in place, unless a    *
+     *  different layout or rotation mode is requested.                       */
+    const canvasParameters = {
+        meshLayout: MeshLayout.InterleavedLayout,
+        rotationMode: RotationMode.IncrementalRotation,
+        ...parameters
+    };
 
     /*  Setup the geometry and add a mesh of vertices and line segments.      */
-    setupMesh(parameters)
+    setupMesh(canvasParameters);
     initGeometry(geometry, meshSize, indexSize);
 
     return geometry;
@@ -0,0 +1,100 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Applies several 4x4 transforms to a wireframe geometry in one pass.   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+import {initGeometry} from "./initGeometry.js";
+import {checkMemoryViews} from "./memoryViews.js";
+import {
+    composeTransforms,
+    mainCanvasAddress,
+    outputBufferAddress,
+    transformCanvas
+} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      transformWireframeGeometry                                            *
+ *  Purpose:                                                                  *
+ *      Composes a list of transforms and applies them to the mesh of a       *
+ *      wireframe geometry in WebAssembly, in a single pass over the points.  *
+ *  Arguments:                                                                *
+ *      geometry (three.BufferGeometry):                                      *
+ *          The geometry being transformed, from canvasWireframeGeometry or   *
+ *          squareWireframeGeometry.                                          *
+ *      matrices (Array):                                                     *
+ *          The three.js Matrix4 transforms, applied in order.                *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      The mesh itself is transformed, so the transforms accumulate from one *
+ *      call to the next, like incremental rotations. Rotations, scales, and  *
+ *      translations are affine, perspective projections divide by w. The     *
+ *      normals and colors, if any, are recomputed.                           *
+ ******************************************************************************/
+export function transformWireframeGeometry(geometry, matrices) {
+
+    /*  Nothing to do for an empty list, avoid a pass over the mesh.          */
+    if (matrices.length == 0) {
+        return;
+    }
+
+    /*  Compose the transforms into one matrix. Each one is applied after     *
+     *  the ones before it.                                                   */
+    let composition = matrices[0].elements;
+
+    for (let index = 1; index < matrices.length; ++index) {
+        composition = composeTransforms(composition, matrices[index].elements);
+    }
+
+    const canvasPtr = geometry.userData.canvas ?? mainCanvasAddress();
+    transformCanvas(canvasPtr, composition);
+
+    /*  embind copies the matrices onto the heap, which may have grown the    *
+     *  memory. Re-create the views in place if so, see memoryViews.js.       */
+    checkMemoryViews();
+
+    /*  The output buffer may have moved, for example when the canvas gets an *
+     *  output buffer of its own, in which case the views need to be          *
+     *  re-created. Memory growth alone was handled above.                    */
+    const positions = geometry.attributes.position.array;
+
+    if (positions.byteOffset != outputBufferAddress(canvasPtr)) {
+        const meshSize = geometry.attributes.position.count * 3;
+        const indexSize = geometry.index.count;
+        initGeometry(geometry, meshSize, indexSize);
+    }
+
+    if (geometry.attributes.normal) {
+        geometry.attributes.normal.needsUpdate = true;
+    }
+
+    /*  The colors follow the heights, which the transform may have changed.  */
+    if (geometry.attributes.color) {
+        geometry.attributes.color.needsUpdate = true;
+    }
+
+    /*  Scales and translations move the surface, update its bounds too.      */
+    geometry.attributes.position.needsUpdate = true;
+    geometry.computeBoundingSphere();
+}
+/*  End of transformWireframeGeometry.                                        */
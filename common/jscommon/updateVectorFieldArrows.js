@@ -0,0 +1,56 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Resamples the vector field drawn by a mesh from vectorFieldArrows.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {sampleVectorField} from "wasmtools";
+import {checkMemoryViews} from "./memoryViews.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      updateVectorFieldArrows                                               *
+ *  Purpose:                                                                  *
+ *      Evaluates the vector field at a new time and uploads the arrows to the*
+ *      GPU.                                                                  *
+ *  Arguments:                                                                *
+ *      arrows (three.InstancedMesh):                                         *
+ *          The arrows, from vectorFieldArrows.                               *
+ *      time (Number):                                                        *
+ *          The time the field is evaluated at.                               *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      This is the only work needed per frame for an animated field, one call*
+ *      into WebAssembly and one buffer upload. The view of the instance      *
+ *      buffer is re-created by checkMemoryViews if the memory grew.          *
+ ******************************************************************************/
+export function updateVectorFieldArrows(arrows, time) {
+
+    const grid = arrows.userData.grid;
+    const buffer = arrows.geometry.attributes.instanceOrigin.data;
+
+    sampleVectorField(grid, time);
+    checkMemoryViews();
+    buffer.needsUpdate = true;
+}
+/*  End of updateVectorFieldArrows.                                           */
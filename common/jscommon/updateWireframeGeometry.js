@@ -0,0 +1,149 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Regenerates a wireframe geometry after its parameters change.         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  StaticDrawUsage tells WebGL the vertices are uploaded once and rarely     *
+ *  change.                                                                   */
+import {BufferAttribute, BufferGeometry, StaticDrawUsage} from "three";
+import {initGeometry} from "./initGeometry.js";
+import {checkMemoryViews} from "./memoryViews.js";
+import {wireframeSizes} from "./wireframeSizes.js";
+import {
+    indexBufferAddress,
+    indexBufferType,
+    IndexType,
+    mainCanvasAddress,
+    MeshLayout,
+    outputBufferAddress,
+    RotationMode,
+    updateCanvasMesh
+} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      updateWireframeGeometry                                               *
+ *  Purpose:                                                                  *
+ *      Recomputes the vertices and line segments of a square wireframe in    *
+ *      WebAssembly, and uploads the parts that changed to the GPU once.      *
+ *  Arguments:                                                                *
+ *      geometry (three.BufferGeometry):                                      *
+ *          The geometry being updated, usually from squareWireframeGeometry. *
+ *      parameters (struct):                                                  *
+ *          The new canvas parameters, with the same fields as for            *
+ *          squareWireframeGeometry.                                          *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      This is meant for use with gpuZRotate, where the mesh only changes    *
+ *      when the parameters do. Calling it every frame defeats the purpose.   *
+ *      The canvas buffers never shrink, so the views are kept when rows are  *
+ *      removed, and when rows are added back, and the draw range is set to   *
+ *      the current index size. Only the new rows are uploaded in the latter  *
+ *      case. The views are re-created if a buffer moved or is too small.     *
+ ******************************************************************************/
+export function updateWireframeGeometry(geometry, parameters) {
+
+    /*  Same sizes as in squareWireframeGeometry.                             */
+    const {meshSize, indexSize} = wireframeSizes(parameters);
+
+    /*  The GPU path rotates through the model matrix and the mesh is never   *
+     *  rotated on the CPU. Use the default layout and mode unless told       *
+     *  otherwise.                                                            */
+    const canvasParameters = {
+        meshLayout: MeshLayout.InterleavedLayout,
+        rotationMode: RotationMode.IncrementalRotation,
+        ...parameters
+    };
+
+    /*  Recompute the mesh in WebAssembly. Geometries from                    *
+     *  canvasWireframeGeometry have their own canvas, which is resized in    *
+     *  place. Only the rows that changed are recomputed, and the index       *
+     *  buffer is left alone unless the shape of the grid changed.            */
+    const canvasPtr = geometry.userData.canvas ?? mainCanvasAddress();
+    const update = updateCanvasMesh(canvasPtr, canvasParameters);
+
+    /*  Re-create the views in place if the memory grew, see memoryViews.js.  */
+    checkMemoryViews();
+
+    /*  The buffers are allocated on the heap. If the buffers have moved, the *
+     *  views are too short for the new sizes, or the index type has changed, *
+     *  the views need to be re-created. Free the old GPU buffers first.      *
+     *  Views longer than the mesh are fine, the rest is not drawn.           */
+    const positions = geometry.attributes.position.array;
+    const indices = geometry.index.array;
+
+    if (update.viewsChanged ||
+        positions.length < meshSize ||
+        indices.length < indexSize ||
+        positions.byteOffset != outputBufferAddress(canvasPtr) ||
+        indices.byteOffset != indexBufferAddress(canvasPtr) ||
+        (indices.BYTES_PER_ELEMENT == 2) !=
+            (indexBufferType(canvasPtr) === IndexType.Uint16Indices)) {
+        geometry.dispose();
+        initGeometry(geometry, meshSize, indexSize);
+    }
+
+    /*  Otherwise the same views are valid, only upload the ranges that were  *
+     *  recomputed. three.js clears the ranges once they are uploaded.        */
+    else {
+        const position = geometry.attributes.position;
+
+        if (update.outputCount > 0) {
+            position.addUpdateRange(update.outputStart, update.outputCount);
+            position.needsUpdate = true;
+        }
+
+        if (update.indexCount > 0) {
+            geometry.index.addUpdateRange(update.indexStart, update.indexCount);
+            geometry.index.needsUpdate = true;
+        }
+
+        /*  All of the normals are recomputed if any row changed, or if rows  *
+         *  were removed, which makes the new last row a boundary row.        */
+        if (geometry.attributes.normal && update.normalsChanged) {
+            geometry.attributes.normal.needsUpdate = true;
+        }
+
+        /*  Likewise for the colors, the whole buffer is uploaded again.      */
+        if (geometry.attributes.color && update.outputCount > 0) {
+            geometry.attributes.color.needsUpdate = true;
+        }
+    }
+
+    /*  Only the line segments of the current grid are drawn.                 */
+    geometry.setDrawRange(0, indexSize);
+
+    /*  The data is static until the next call to this function.              */
+    geometry.attributes.position.setUsage(StaticDrawUsage);
+    geometry.index.setUsage(StaticDrawUsage);
+
+    /*  computeBoundingSphere reads the whole attribute, which may have rows  *
+     *  past the draw range left over from a larger grid. Use the used part.  */
+    const visible = new BufferGeometry();
+    const used = geometry.attributes.position.array.subarray(0, meshSize);
+    visible.setAttribute("position", new BufferAttribute(used, 3));
+    visible.computeBoundingSphere();
+    geometry.boundingSphere = visible.boundingSphere;
+}
+/*  End of updateWireframeGeometry.                                           */
@@ -0,0 +1,229 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Draws a sampled vector field as a single instanced mesh of arrows.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {
+    ConeGeometry,
+    CylinderGeometry,
+    InstancedInterleavedBuffer,
+    InstancedMesh,
+    InterleavedBufferAttribute,
+    MeshBasicMaterial
+} from "three";
+
+import {mergeGeometries} from "three/addons/utils/BufferGeometryUtils.js";
+import {trackMemoryViews} from "./memoryViews.js";
+import {
+    createVectorField,
+    memory,
+    sampleVectorField,
+    vectorFieldInstancesAddress
+} from "wasmtools";
+
+/*  Number of floats per arrow, VECTOR_FIELD_INSTANCE_SIZE in types.h. This   *
+ *  is the position, the unit direction, and the magnitude of the field.      */
+const INSTANCE_SIZE = 7;
+
+/*  Number of sides for the shaft and the head of the arrow.                  */
+const RADIAL_SEGMENTS = 8;
+
+/*  Declarations added to the top of the vertex shader. The arrow geometry    *
+ *  points along +y, the basis rotates +y onto the direction of the field.    *
+ *  Zero vectors have no direction, they are drawn with zero length instead.  */
+const ARROW_DECLARATIONS = `
+attribute vec3 instanceOrigin;
+attribute vec3 instanceDirection;
+attribute float instanceMagnitude;
+uniform float arrowScale;
+uniform float maxArrowLength;
+
+mat3 arrowBasis() {
+    vec3 d = instanceMagnitude > 0.0 ? instanceDirection : vec3(0.0, 1.0, 0.0);
+    vec3 up = abs(d.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    vec3 t = normalize(cross(up, d));
+    return mat3(t, d, cross(t, d));
+}
+
+float arrowLength() {
+    return min(instanceMagnitude * arrowScale, maxArrowLength);
+}
+`;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      arrowGeometry                                                         *
+ *  Purpose:                                                                  *
+ *      Creates a single arrow, a cylinder for the shaft and a cone for the   *
+ *      head, from the origin to (0, 1, 0).                                   *
+ *  Arguments:                                                                *
+ *      None.                                                                 *
+ *  Output:                                                                   *
+ *      geometry (three.BufferGeometry):                                      *
+ *          The geometry for one arrow.                                       *
+ *  Notes:                                                                    *
+ *      The widths are proportional to the length, like the arrows made with  *
+ *      ArrowHelper in the vector field pages, so short arrows are also thin. *
+ ******************************************************************************/
+function arrowGeometry() {
+
+    /*  The head is the last quarter of the arrow, the shaft is the rest.     */
+    const shaft = new CylinderGeometry(0.02, 0.02, 0.75, RADIAL_SEGMENTS);
+    const head = new ConeGeometry(0.0625, 0.25, RADIAL_SEGMENTS);
+
+    /*  Both are centered at the origin, move them into place.                */
+    shaft.translate(0.0, 0.375, 0.0);
+    head.translate(0.0, 0.875, 0.0);
+
+    const geometry = mergeGeometries([shaft, head]);
+    shaft.dispose();
+    head.dispose();
+
+    return geometry;
+}
+/*  End of arrowGeometry.                                                     */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      instanceBuffer                                                        *
+ *  Purpose:                                                                  *
+ *      Creates a view of the instance buffer of a vector field grid.         *
+ *  Arguments:                                                                *
+ *      grid (Number):                                                        *
+ *          The address of the grid, from createVectorField.                  *
+ *      count (Number):                                                       *
+ *          The number of arrows in the grid.                                 *
+ *  Output:                                                                   *
+ *      view (Float32Array):                                                  *
+ *          The instance buffer, living in the WebAssembly memory.            *
+ ******************************************************************************/
+function instanceBuffer(grid, count) {
+    const address = vectorFieldInstancesAddress(grid);
+    return new Float32Array(memory.buffer, address, INSTANCE_SIZE * count);
+}
+/*  End of instanceBuffer.                                                    */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      vectorFieldArrows                                                     *
+ *  Purpose:                                                                  *
+ *      Samples a vector field in WebAssembly and draws it as one instanced   *
+ *      mesh, with one arrow per point of the grid.                           *
+ *  Arguments:                                                                *
+ *      parameters (struct):                                                  *
+ *          The grid parameters: nxPts, nyPts, nzPts, width, height, depth,   *
+ *          xStart, yStart, and zStart.                                       *
+ *      arrowScale (Number):                                                  *
+ *          The length of an arrow per unit of magnitude of the field.        *
+ *      maxArrowLength (Number):                                              *
+ *          The longest an arrow may be, so that the arrows near a singularity*
+ *          do not cover the scene.                                           *
+ *      material (three.Material):                                            *
+ *          Optional, the material for the arrows. Defaults to a white        *
+ *          MeshBasicMaterial.                                                *
+ *  Output:                                                                   *
+ *      arrows (three.InstancedMesh):                                         *
+ *          The arrows, animated with updateVectorFieldArrows.                *
+ *  Notes:                                                                    *
+ *      The field is the sampleVectorField function of the animation's        *
+ *      WebAssembly module. The arrows are placed in the vertex shader from   *
+ *      the instance buffer written by sample_vector_field, so a frame uploads*
+ *      seven floats per arrow and nothing is created in JavaScript. The      *
+ *      instance matrices are left as the identity and are never uploaded     *
+ *      again. The grid is not freed with the mesh, call destroyVectorField on*
+ *      arrows.userData.grid once it is disposed.                             *
+ ******************************************************************************/
+export function vectorFieldArrows(
+    parameters,
+    arrowScale,
+    maxArrowLength,
+    material = new MeshBasicMaterial({color: 0xFFFFFF})
+) {
+
+    /*  One arrow per point of the grid, sampled at the start of time.        */
+    const count = parameters.nxPts * parameters.nyPts * parameters.nzPts;
+    const grid = createVectorField(parameters);
+    sampleVectorField(grid, 0.0);
+
+    /*  The instance buffer is rewritten every frame, a single upload.        */
+    const geometry = arrowGeometry();
+    const buffer = new InstancedInterleavedBuffer(
+        instanceBuffer(grid, count), INSTANCE_SIZE, 1
+    );
+
+    geometry.setAttribute(
+        'instanceOrigin', new InterleavedBufferAttribute(buffer, 3, 0)
+    );
+
+    geometry.setAttribute(
+        'instanceDirection', new InterleavedBufferAttribute(buffer, 3, 3)
+    );
+
+    geometry.setAttribute(
+        'instanceMagnitude', new InterleavedBufferAttribute(buffer, 1, 6)
+    );
+
+    /*  The instance buffer is a view into the WebAssembly memory, which is   *
+     *  re-created if the memory grows, see memoryViews.js.                   */
+    trackMemoryViews(geometry, [buffer]);
+
+    /*  Shared with the shader, these may be changed at any time.             */
+    const uniforms = {
+        arrowScale: {value: arrowScale},
+        maxArrowLength: {value: maxArrowLength}
+    };
+
+    /*  Scale and rotate the arrow into place before the model and instance   *
+     *  matrices are applied. The normals are rotated the same way.           */
+    material.onBeforeCompile = function(shader) {
+        Object.assign(shader.uniforms, uniforms);
+
+        shader.vertexShader = shader.vertexShader
+            .replace(
+                "#include <common>",
+                "#include <common>" + ARROW_DECLARATIONS
+            )
+            .replace(
+                "#include <beginnormal_vertex>",
+                "vec3 objectNormal = arrowBasis() * normal;"
+            )
+            .replace(
+                "#include <begin_vertex>",
+                "vec3 transformed = instanceOrigin + " +
+                "arrowBasis() * (arrowLength() * position);"
+            );
+    };
+
+    /*  Keep the patched program apart from the unpatched one.                */
+    material.customProgramCacheKey = () => "vectorFieldArrows";
+
+    /*  The bounding sphere of an InstancedMesh comes from the instance       *
+     *  matrices, which do not know where the arrows are. Never cull them.    */
+    const arrows = new InstancedMesh(geometry, material, count);
+    arrows.frustumCulled = false;
+    arrows.userData.grid = grid;
+    arrows.userData.uniforms = uniforms;
+
+    return arrows;
+}
+/*  End of vectorFieldArrows.                                                 */
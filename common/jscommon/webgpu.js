@@ -0,0 +1,32 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Exports the WebGPU functions from common/jscommon/. These import      *
+ *      three/webgpu and three/tsl, so they are bundled on their own and only *
+ *      downloaded by the figures that use them.                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+export {webgpuComputeCheck} from "./webgpuComputeCheck.js";
+export {webgpuHomotopy} from "./webgpuHomotopy.js";
+export {webgpuHomotopyGeometry} from "./webgpuHomotopyGeometry.js";
+export {webgpuSceneRenderer} from "./webgpuSceneRenderer.js";
+export {webgpuWireframeGeometry} from "./webgpuWireframeGeometry.js";
+export {webgpuZRotate} from "./webgpuZRotate.js";
@@ -0,0 +1,56 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Checks whether the browser can render and compute with WebGPU.        *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuAvailable                                                       *
+ *  Purpose:                                                                  *
+ *      Checks if the browser exposes WebGPU and has a usable adapter.        *
+ *  Arguments:                                                                *
+ *      None.                                                                 *
+ *  Output:                                                                   *
+ *      available (Promise<Boolean>):                                         *
+ *          True if an adapter was found, false otherwise.                    *
+ *  Notes:                                                                    *
+ *      navigator.gpu alone is not enough, browsers may expose it and still   *
+ *      return no adapter, for example on blocklisted drivers.                *
+ ******************************************************************************/
+export async function webgpuAvailable() {
+
+    /*  Older browsers, and insecure (non-HTTPS) pages, have no WebGPU.       */
+    if (navigator.gpu === undefined) {
+        return false;
+    }
+
+    /*  requestAdapter resolves to null if no adapter is available, and may   *
+     *  throw on some implementations instead.                                */
+    try {
+        const adapter = await navigator.gpu.requestAdapter();
+        return adapter !== null;
+    } catch (error) {
+        return false;
+    }
+}
+/*  End of webgpuAvailable.                                                   */
@@ -0,0 +1,253 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Compute shaders mirroring the threetools mesh kernels, for WebGPU.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The kernels are written in TSL, which three.js compiles to WGSL.          */
+import {Fn, If, float, instanceIndex, uint, vec3} from "three/tsl";
+import {MeshType} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      computeSupported                                                      *
+ *  Purpose:                                                                  *
+ *      Checks if a renderer can run the compute shaders in this file.        *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGLRenderer or three.WebGPURenderer):               *
+ *          The renderer for the animation.                                   *
+ *  Output:                                                                   *
+ *      supported (Boolean):                                                  *
+ *          True if the renderer draws with WebGPU, false otherwise.          *
+ *  Notes:                                                                    *
+ *      A WebGPURenderer falls back to WebGL 2 if the adapter is missing. The *
+ *      WebAssembly kernels are used in that case, not the WebGL 2 emulation  *
+ *      of compute shaders.                                                   *
+ ******************************************************************************/
+export function computeSupported(renderer) {
+    return renderer.backend !== undefined &&
+        renderer.backend.isWebGPUBackend === true;
+}
+/*  End of computeSupported.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      computeMeshSupported                                                  *
+ *  Purpose:                                                                  *
+ *      Checks if the compute shaders in this file can generate a mesh type.  *
+ *  Arguments:                                                                *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters, meshType is SquareWireframe if not given.  *
+ *  Output:                                                                   *
+ *      supported (Boolean):                                                  *
+ *          True for square wireframes, false otherwise.                      *
+ *  Notes:                                                                    *
+ *      The kernels sample both axes end to end and only write the segments   *
+ *      of a square wireframe. Glued grids and triangle wireframes use the    *
+ *      WebAssembly kernels.                                                  *
+ ******************************************************************************/
+export function computeMeshSupported(parameters) {
+    const {meshType = MeshType.SquareWireframe} = parameters;
+    return (meshType.value ?? meshType) === MeshType.SquareWireframe.value;
+}
+/*  End of computeMeshSupported.                                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      parametricMeshKernel                                                  *
+ *  Purpose:                                                                  *
+ *      Creates the compute shader for the vertices of a mesh z = f(x, y).    *
+ *      This is the same as generate_parametric_mesh.                         *
+ *  Arguments:                                                                *
+ *      positions (StorageBufferNode):                                        *
+ *          The vec3 buffer the vertices are written to.                      *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters: nxPts, nyPts, width, height, xStart, and   *
+ *          yStart.                                                           *
+ *      surface (Function):                                                   *
+ *          The surface, taking the x and y nodes and returning the z node.   *
+ *  Output:                                                                   *
+ *      kernel (ComputeNode):                                                 *
+ *          The shader, with one invocation per vertex.                       *
+ ******************************************************************************/
+export function parametricMeshKernel(positions, parameters, surface) {
+
+    /*  Step sizes in the horizontal and vertical axes.                       */
+    const dx = parameters.width / (parameters.nxPts - 1);
+    const dy = parameters.height / (parameters.nyPts - 1);
+    const numberOfPoints = parameters.nxPts * parameters.nyPts;
+
+    return Fn(() => {
+
+        /*  The dispatch is rounded up to a whole number of workgroups.       */
+        If(instanceIndex.lessThan(uint(numberOfPoints)), () => {
+
+            /*  The mesh is row-major, index = y * width + x.                 */
+            const xIndex = instanceIndex.mod(uint(parameters.nxPts));
+            const yIndex = instanceIndex.div(uint(parameters.nxPts));
+
+            /*  Convert the pixel indices to coordinates in the plane.        */
+            const x = float(xIndex).mul(dx).add(parameters.xStart).toVar();
+            const y = float(yIndex).mul(dy).add(parameters.yStart).toVar();
+
+            positions.element(instanceIndex).assign(vec3(x, y, surface(x, y)));
+        });
+    })().compute(numberOfPoints);
+}
+/*  End of parametricMeshKernel.                                              */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rectangularWireframeKernel                                            *
+ *  Purpose:                                                                  *
+ *      Creates the compute shader for the line segments of a square          *
+ *      wireframe. This is the same as generate_rectangular_wireframe.        *
+ *  Arguments:                                                                *
+ *      indices (StorageBufferNode):                                          *
+ *          The uint buffer the indices are written to.                       *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters, only nxPts and nyPts are used.             *
+ *  Output:                                                                   *
+ *      kernel (ComputeNode):                                                 *
+ *          The shader, with one invocation per vertex.                       *
+ *  Notes:                                                                    *
+ *      Each point writes the "L" of segments up and to the right, at the     *
+ *      same offset store_rectangular_row uses. The index buffers are equal.  *
+ ******************************************************************************/
+export function rectangularWireframeKernel(indices, parameters) {
+
+    /*  Every row but the last has nxPts vertical segments and nxPts - 1      *
+     *  horizontal segments, each with two indices.                           */
+    const nxPts = uint(parameters.nxPts);
+    const rowSize = 2 * (2 * parameters.nxPts - 1);
+    const numberOfPoints = parameters.nxPts * parameters.nyPts;
+
+    return Fn(() => {
+
+        If(instanceIndex.lessThan(uint(numberOfPoints)), () => {
+
+            const point = instanceIndex;
+            const xIndex = point.mod(nxPts);
+            const yIndex = point.div(nxPts);
+
+            /*  Below the last row every point connects to the point above it,*
+             *  and all but the last point of the row to the one on its right.*/
+            If(yIndex.lessThan(uint(parameters.nyPts - 1)), () => {
+                const index = yIndex.mul(rowSize).add(xIndex.mul(4)).toVar();
+
+                indices.element(index).assign(point);
+                indices.element(index.add(1)).assign(point.add(nxPts));
+
+                If(xIndex.lessThan(uint(parameters.nxPts - 1)), () => {
+                    indices.element(index.add(2)).assign(point);
+                    indices.element(index.add(3)).assign(point.add(1));
+                });
+            })
+
+            /*  The last row has no points above it, only horizontal segments.*/
+            .ElseIf(xIndex.lessThan(uint(parameters.nxPts - 1)), () => {
+                const index = yIndex.mul(rowSize).add(xIndex.mul(2)).toVar();
+
+                indices.element(index).assign(point);
+                indices.element(index.add(1)).assign(point.add(1));
+            });
+        });
+    })().compute(numberOfPoints);
+}
+/*  End of rectangularWireframeKernel.                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rotateMeshKernel                                                      *
+ *  Purpose:                                                                  *
+ *      Creates the compute shader rotating a mesh about the z axis in place. *
+ *      This is the same as rotate_mesh.                                      *
+ *  Arguments:                                                                *
+ *      positions (StorageBufferNode):                                        *
+ *          The vec3 buffer with the vertices.                                *
+ *      numberOfPoints (Number):                                              *
+ *          The number of vertices in the buffer.                             *
+ *      rotation (struct):                                                    *
+ *          The cosAngle and sinAngle uniforms of the angle of rotation.      *
+ *  Output:                                                                   *
+ *      kernel (ComputeNode):                                                 *
+ *          The shader, with one invocation per vertex.                       *
+ ******************************************************************************/
+export function rotateMeshKernel(positions, numberOfPoints, rotation) {
+    return Fn(() => {
+
+        If(instanceIndex.lessThan(uint(numberOfPoints)), () => {
+
+            /*  Read the point once, it is overwritten below.                 */
+            const point = positions.element(instanceIndex).toVar();
+
+            /*  Apply the rotation matrix, the z component is unchanged.      */
+            const x = rotation.cosAngle.mul(point.x).sub(
+                rotation.sinAngle.mul(point.y)
+            );
+
+            const y = rotation.cosAngle.mul(point.y).add(
+                rotation.sinAngle.mul(point.x)
+            );
+
+            positions.element(instanceIndex).assign(vec3(x, y, point.z));
+        });
+    })().compute(numberOfPoints);
+}
+/*  End of rotateMeshKernel.                                                  */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      homotopyKernel                                                        *
+ *  Purpose:                                                                  *
+ *      Creates the compute shader for the straight-line homotopy             *
+ *      (1 - t) f + t g. This is the same as homotopy_canvas.                 *
+ *  Arguments:                                                                *
+ *      output (StorageBufferNode):                                           *
+ *          The vec3 buffer the blended mesh is written to.                   *
+ *      start (StorageBufferNode):                                            *
+ *          The vec3 buffer with the start mesh, f.                           *
+ *      end (StorageBufferNode):                                              *
+ *          The vec3 buffer with the end mesh, g.                             *
+ *      numberOfPoints (Number):                                              *
+ *          The number of vertices in each buffer.                            *
+ *      time (UniformNode):                                                   *
+ *          The time parameter, t.                                            *
+ *  Output:                                                                   *
+ *      kernel (ComputeNode):                                                 *
+ *          The shader, with one invocation per vertex.                       *
+ ******************************************************************************/
+export function homotopyKernel(output, start, end, numberOfPoints, time) {
+    return Fn(() => {
+
+        If(instanceIndex.lessThan(uint(numberOfPoints)), () => {
+
+            /*  As in homotopy_canvas, (1 - t) f + t g gives the endpoints    *
+             *  exactly at t = 0 and t = 1, unlike f + t (g - f).             */
+            const f = start.element(instanceIndex).mul(float(1.0).sub(time));
+            const g = end.element(instanceIndex).mul(time);
+
+            output.element(instanceIndex).assign(f.add(g));
+        });
+    })().compute(numberOfPoints);
+}
+/*  End of homotopyKernel.                                                    */
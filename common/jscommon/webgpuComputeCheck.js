@@ -0,0 +1,160 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Runs the compute shaders once and compares them with the WebAssembly  *
+ *      kernels they mirror.                                                  *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+
+import {squareWireframeGeometry} from "./squareWireframeGeometry.js";
+import {webgpuHomotopyGeometry} from "./webgpuHomotopyGeometry.js";
+import {webgpuWireframeGeometry} from "./webgpuWireframeGeometry.js";
+import {computeMeshSupported, computeSupported} from "./webgpuCompute.js";
+
+/*  Largest difference between a shader and the WebAssembly kernels that is   *
+ *  still a pass. The GPU may fuse or reorder the float operations.           */
+const tolerance = 1.0E-5;
+
+/*  Largest absolute difference between two arrays of the same length.        */
+function maxError(computed, expected) {
+    let error = 0.0;
+
+    for (let index = 0; index < expected.length; ++index) {
+        error = Math.max(error, Math.abs(computed[index] - expected[index]));
+    }
+
+    return error;
+}
+
+/*  Reads a storage buffer back from the GPU as floats.                       */
+async function readFloats(renderer, attribute) {
+    return new Float32Array(await renderer.getArrayBufferAsync(attribute));
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuComputeCheck                                                    *
+ *  Purpose:                                                                  *
+ *      Runs each compute shader in webgpuCompute.js on the GPU, reads the    *
+ *      result back, and compares it with the WebAssembly kernels.            *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGPURenderer or three.WebGLRenderer):               *
+ *          The renderer for the animation, from webgpuSceneRenderer.         *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters, see webgpuWireframeGeometry.               *
+ *      surface (Function):                                                   *
+ *          The surface in TSL. It must be the surface compiled into          *
+ *          main.wasm, which is used as the reference.                        *
+ *  Output:                                                                   *
+ *      result (Promise<struct> or Promise<null>):                            *
+ *          The largest errors of the mesh, rotation, and homotopy shaders,   *
+ *          whether the index buffers are equal, and passed, which is true if *
+ *          every shader agrees. null if the shaders can not be run.          *
+ *  Notes:                                                                    *
+ *      This sets up the main canvas of main.wasm for the reference, so call  *
+ *      it before creating a geometry that draws from it. The buffers of the  *
+ *      check are not drawn and are left to the garbage collector.            *
+ ******************************************************************************/
+export async function webgpuComputeCheck(renderer, parameters, surface) {
+
+    /*  Nothing runs on the GPU in this case, the WebAssembly kernels are     *
+     *  used directly.                                                        */
+    if (!computeSupported(renderer) || !computeMeshSupported(parameters)) {
+        return null;
+    }
+
+    /*  The reference geometry is a view into the WebAssembly memory. Copy it *
+     *  so that it is still valid if the memory grows.                        */
+    const reference = squareWireframeGeometry(parameters);
+    const expected = reference.attributes.position.array.slice();
+    const expectedIndices = reference.index.array.slice();
+
+    /*  generate_parametric_mesh and generate_rectangular_wireframe.          */
+    const geometry = webgpuWireframeGeometry(renderer, parameters, surface);
+    const compute = geometry.userData.compute;
+    const mesh = await readFloats(renderer, compute.positions.value);
+
+    const indices = new Uint32Array(
+        await renderer.getArrayBufferAsync(geometry.index)
+    );
+
+    const indicesMatch = indices.length === expectedIndices.length &&
+        indices.every((value, index) => value === expectedIndices[index]);
+
+    /*  rotate_mesh, by an angle that changes both x and y.                   */
+    const angle = 0.5;
+    const cosAngle = Math.cos(angle);
+    const sinAngle = Math.sin(angle);
+    const rotated = new Float32Array(expected.length);
+
+    for (let index = 0; index < expected.length; index += 3) {
+        const x = expected[index];
+        const y = expected[index + 1];
+        rotated[index] = cosAngle*x - sinAngle*y;
+        rotated[index + 1] = cosAngle*y + sinAngle*x;
+        rotated[index + 2] = expected[index + 2];
+    }
+
+    compute.rotation.cosAngle.value = cosAngle;
+    compute.rotation.sinAngle.value = sinAngle;
+    renderer.compute(compute.rotate);
+
+    const rotation = await readFloats(renderer, compute.positions.value);
+
+    /*  homotopy_canvas, from the surface to its reflection z = -f(x, y). The *
+     *  blend at t is the surface scaled by 1 - 2t.                           */
+    const t = 0.25;
+    const blended = expected.slice();
+
+    for (let index = 2; index < expected.length; index += 3) {
+        blended[index] = (1.0 - 2.0*t) * expected[index];
+    }
+
+    const reflection = (x, y) => surface(x, y).negate();
+    const homotopy =
+        webgpuHomotopyGeometry(renderer, parameters, surface, reflection);
+
+    homotopy.userData.compute.time.value = t;
+    renderer.compute(homotopy.userData.compute.homotopy);
+
+    const blend =
+        await readFloats(renderer, homotopy.userData.compute.positions.value);
+
+    /*  A padded or mis-sized buffer shows up as a length mismatch, and as an *
+     *  error of NaN or Infinity rather than zero.                            */
+    const sizesMatch = mesh.length === expected.length &&
+        rotation.length === expected.length && blend.length === expected.length;
+
+    const result = {
+        meshError: maxError(mesh, expected),
+        indicesMatch: indicesMatch,
+        rotationError: maxError(rotation, rotated),
+        homotopyError: maxError(blend, blended)
+    };
+
+    result.passed = sizesMatch && indicesMatch &&
+        result.meshError <= tolerance &&
+        result.rotationError <= tolerance &&
+        result.homotopyError <= tolerance;
+
+    return result;
+}
+/*  End of webgpuComputeCheck.                                                */
@@ -0,0 +1,67 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Renders a frame of a straight-line homotopy computed on the GPU.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {canvasHomotopy} from "./canvasHomotopy.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuHomotopy                                                        *
+ *  Purpose:                                                                  *
+ *      Blends the two meshes of a homotopy with a compute shader and renders *
+ *      the scene.                                                            *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGPURenderer or three.WebGLRenderer):               *
+ *          The renderer for the animation.                                   *
+ *      scene (three.Scene):                                                  *
+ *          The scene containing the surface.                                 *
+ *      camera (three.PerspectiveCamera):                                     *
+ *          The camera used for viewing the animation.                        *
+ *      surface (three.Object3D):                                             *
+ *          The object being rendered, with a geometry from                   *
+ *          webgpuHomotopyGeometry.                                           *
+ *      target (Number):                                                      *
+ *          The address of the canvas holding the end mesh, only used if the  *
+ *          geometry was created without WebGPU. See canvasHomotopy.          *
+ *      t (Number):                                                           *
+ *          The time parameter, between 0 and 1.                              *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ ******************************************************************************/
+export function webgpuHomotopy(renderer, scene, camera, surface, target, t) {
+
+    const compute = surface.geometry.userData.compute;
+
+    /*  The fallback geometry has a canvas, blend it in WebAssembly.          */
+    if (compute === undefined) {
+        canvasHomotopy(renderer, scene, camera, surface, target, t);
+        return;
+    }
+
+    /*  Only the uniform changes, the endpoint meshes stay on the GPU.        */
+    compute.time.value = t;
+    renderer.compute(compute.homotopy);
+    renderer.render(scene, camera);
+}
+/*  End of webgpuHomotopy.                                                    */
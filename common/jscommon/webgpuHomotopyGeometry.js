@@ -0,0 +1,108 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a wireframe for a homotopy between two GPU-computed surfaces. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {BufferGeometry, Sphere, Vector3} from "three";
+import {attributeArray, uniform} from "three/tsl";
+import {canvasWireframeGeometry} from "./canvasWireframeGeometry.js";
+import {wireframeSizes} from "./wireframeSizes.js";
+import {
+    computeMeshSupported,
+    computeSupported,
+    homotopyKernel,
+    parametricMeshKernel,
+    rectangularWireframeKernel
+} from "./webgpuCompute.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuHomotopyGeometry                                                *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe for the straight-line homotopy between two *
+ *      surfaces z = f(x, y) and z = g(x, y), computed on the GPU.            *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGPURenderer or three.WebGLRenderer):               *
+ *          The renderer for the animation, from webgpuSceneRenderer.         *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters, shared by both surfaces. See               *
+ *          webgpuWireframeGeometry.                                          *
+ *      start (Function):                                                     *
+ *          The start surface in TSL, f, drawn at t = 0.                      *
+ *      end (Function):                                                       *
+ *          The end surface in TSL, g, drawn at t = 1.                        *
+ *  Output:                                                                   *
+ *      geometry (three.BufferGeometry):                                      *
+ *          The geometry, rendered with webgpuHomotopy. The buffers and the   *
+ *          homotopy shader are stored in geometry.userData.compute.          *
+ *  Notes:                                                                    *
+ *      Both endpoint meshes are computed once and kept in storage buffers    *
+ *      that are never drawn, only the blend is. If the renderer is not using *
+ *      WebGPU, or the mesh type is not SquareWireframe, this is              *
+ *      canvasWireframeGeometry, and the end canvas is passed to              *
+ *      webgpuHomotopy as for canvasHomotopy.                                 *
+ ******************************************************************************/
+export function webgpuHomotopyGeometry(renderer, parameters, start, end) {
+
+    /*  The WebAssembly kernels are the reference, and the fallback.          */
+    if (!computeSupported(renderer) || !computeMeshSupported(parameters)) {
+        return canvasWireframeGeometry(parameters);
+    }
+
+    /*  Same sizes as in webgpuWireframeGeometry.                             */
+    const geometry = new BufferGeometry();
+    const product = parameters.nxPts * parameters.nyPts;
+    const {indexSize} = wireframeSizes(parameters);
+
+    const startMesh = attributeArray(product, "vec3");
+    const endMesh = attributeArray(product, "vec3");
+    const positions = attributeArray(product, "vec3");
+    const indices = attributeArray(indexSize, "uint");
+
+    /*  Both surfaces share the grid, and hence the line segments.            */
+    renderer.compute(parametricMeshKernel(startMesh, parameters, start));
+    renderer.compute(parametricMeshKernel(endMesh, parameters, end));
+    renderer.compute(rectangularWireframeKernel(indices, parameters));
+
+    /*  Start at t = 0, the first frame then shows the start surface.         */
+    const time = uniform(0.0);
+    const blend = homotopyKernel(positions, startMesh, endMesh, product, time);
+    renderer.compute(blend);
+
+    geometry.setAttribute('position', positions.value);
+    geometry.setIndex(indices.value);
+
+    /*  See webgpuWireframeGeometry, the vertices never reach the CPU.        */
+    geometry.boundingSphere = new Sphere(new Vector3(), Infinity);
+
+    geometry.userData.compute = {
+        positions: positions,
+        start: startMesh,
+        end: endMesh,
+        time: time,
+        homotopy: blend
+    };
+
+    return geometry;
+}
+/*  End of webgpuHomotopyGeometry.                                            */
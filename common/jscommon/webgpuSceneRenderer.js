@@ -0,0 +1,69 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a WebGPU renderer for a scene, or WebGL if it is unavailable. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  The WebGPU renderer lives in its own entry point, separate from WebGL.    */
+import {WebGPURenderer} from "three/webgpu";
+import {sceneRenderer} from "./sceneRenderer.js";
+import {webgpuAvailable} from "./webgpuAvailable.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuSceneRenderer                                                   *
+ *  Purpose:                                                                  *
+ *      Initializes a WebGPU renderer for the animation, with the same        *
+ *      defaults as sceneRenderer.                                            *
+ *  Arguments:                                                                *
+ *      sceneWindow (Window):                                                 *
+ *          The window for the animation.                                     *
+ *  Output:                                                                   *
+ *      renderer (Promise<three.WebGPURenderer or three.WebGLRenderer>):      *
+ *          The renderer for the animation. This is the WebGL renderer from   *
+ *          sceneRenderer if WebGPU is not available.                         *
+ *  Notes:                                                                    *
+ *      The webgpu functions check the renderer, and use the WebAssembly      *
+ *      kernels when it is not drawing with WebGPU.                           *
+ ******************************************************************************/
+export async function webgpuSceneRenderer(sceneWindow) {
+
+    /*  Without an adapter the WebGPU renderer would fall back to WebGL 2     *
+     *  itself. Use the usual WebGL renderer instead, it is better tested.    */
+    if (!(await webgpuAvailable())) {
+        return sceneRenderer(sceneWindow);
+    }
+
+    /*  Same antialiasing as sceneRenderer, see the comments there.           */
+    const rendererParameters = {antialias: true};
+    const renderer = new WebGPURenderer(rendererParameters);
+
+    /*  The device is requested asynchronously. Compute shaders can only be   *
+     *  dispatched once this has finished.                                    */
+    await renderer.init();
+
+    renderer.setPixelRatio(sceneWindow.devicePixelRatio);
+    renderer.setSize(sceneWindow.innerWidth, sceneWindow.innerHeight);
+    renderer.shadowMap.enabled = false;
+    return renderer;
+}
+/*  End of webgpuSceneRenderer.                                               */
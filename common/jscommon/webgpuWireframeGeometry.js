@@ -0,0 +1,105 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe whose mesh is computed on the GPU.         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {BufferGeometry, Sphere, Vector3} from "three";
+import {attributeArray, uniform} from "three/tsl";
+import {squareWireframeGeometry} from "./squareWireframeGeometry.js";
+import {wireframeSizes} from "./wireframeSizes.js";
+import {
+    computeMeshSupported,
+    computeSupported,
+    parametricMeshKernel,
+    rectangularWireframeKernel,
+    rotateMeshKernel
+} from "./webgpuCompute.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuWireframeGeometry                                               *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe for a surface z = f(x, y), with the        *
+ *      vertices and line segments computed by compute shaders directly into  *
+ *      the GPU buffers that are drawn.                                       *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGPURenderer or three.WebGLRenderer):               *
+ *          The renderer for the animation, from webgpuSceneRenderer.         *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters: nxPts, nyPts, width, height, xStart, and   *
+ *          yStart, the same as for squareWireframeGeometry.                  *
+ *      surface (Function):                                                   *
+ *          The surface in TSL, taking the x and y nodes and returning the z  *
+ *          node. For example, (x, y) => x.mul(x).add(y.mul(y).mul(2.0)).     *
+ *  Output:                                                                   *
+ *      geometry (three.BufferGeometry):                                      *
+ *          The geometry, rendered with webgpuZRotate. The buffers and the    *
+ *          rotation shader are stored in geometry.userData.compute.          *
+ *  Notes:                                                                    *
+ *      The mesh is never in JavaScript or WebAssembly memory, three.js only  *
+ *      allocates the zeroed arrays used to create the buffers. If the        *
+ *      renderer is not using WebGPU, or the mesh type is not SquareWireframe,*
+ *      this is squareWireframeGeometry and the surface compiled into         *
+ *      main.wasm is used instead.                                            *
+ ******************************************************************************/
+export function webgpuWireframeGeometry(renderer, parameters, surface) {
+
+    /*  The WebAssembly kernels are the reference, and the fallback. They are *
+     *  also used for the mesh types the compute shaders do not generate.     */
+    if (!computeSupported(renderer) || !computeMeshSupported(parameters)) {
+        return squareWireframeGeometry(parameters);
+    }
+
+    /*  Same sizes as in squareWireframeGeometry. Indices are always 32-bit,  *
+     *  storage buffers have no 16-bit integers.                              */
+    const geometry = new BufferGeometry();
+    const product = parameters.nxPts * parameters.nyPts;
+    const {indexSize} = wireframeSizes(parameters);
+
+    const positions = attributeArray(product, "vec3");
+    const indices = attributeArray(indexSize, "uint");
+
+    /*  Compute the mesh and the line segments once, on the GPU.              */
+    renderer.compute(parametricMeshKernel(positions, parameters, surface));
+    renderer.compute(rectangularWireframeKernel(indices, parameters));
+
+    /*  The storage buffers are drawn as they are, nothing is copied.         */
+    geometry.setAttribute('position', positions.value);
+    geometry.setIndex(indices.value);
+
+    /*  The vertices never reach the CPU, so the bounding sphere can not be   *
+     *  computed from them. Use an unbounded sphere, which is never culled.   */
+    geometry.boundingSphere = new Sphere(new Vector3(), Infinity);
+
+    /*  The angle is set per frame, the shader itself is built once.          */
+    const rotation = {cosAngle: uniform(1.0), sinAngle: uniform(0.0)};
+
+    geometry.userData.compute = {
+        positions: positions,
+        rotation: rotation,
+        rotate: rotateMeshKernel(positions, product, rotation)
+    };
+
+    return geometry;
+}
+/*  End of webgpuWireframeGeometry.                                           */
@@ -0,0 +1,74 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Rotates a GPU-computed surface about the z axis with a compute shader.*
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {setRotationAngle} from "wasmtools";
+import {zRotate} from "./zRotate.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      webgpuZRotate                                                         *
+ *  Purpose:                                                                  *
+ *      Rotates the surface slowly about the z axis and renders the scene.    *
+ *      The vertices are rotated in place by a compute shader.                *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGPURenderer or three.WebGLRenderer):               *
+ *          The renderer for the animation.                                   *
+ *      scene (three.Scene):                                                  *
+ *          The scene containing the surface.                                 *
+ *      camera (three.PerspectiveCamera):                                     *
+ *          The camera used for viewing the animation.                        *
+ *      surface (three.Object3D):                                             *
+ *          The object being rotated, with a geometry from                    *
+ *          webgpuWireframeGeometry.                                          *
+ *      angle (Number):                                                       *
+ *          The angle of rotation between frames.                             *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Geometries created without WebGPU are rotated by zRotate instead.     *
+ ******************************************************************************/
+export function webgpuZRotate(renderer, scene, camera, surface, angle) {
+
+    const compute = surface.geometry.userData.compute;
+
+    /*  The fallback geometry is a view into the WebAssembly memory. This     *
+     *  only saves the angle and its sine and cosine, it is cheap to repeat.  */
+    if (compute === undefined) {
+        setRotationAngle(angle);
+        zRotate(renderer, scene, camera, surface);
+        return;
+    }
+
+    /*  The sine and cosine are the same for every point, compute them once   *
+     *  here rather than in each invocation of the shader.                    */
+    compute.rotation.cosAngle.value = Math.cos(angle);
+    compute.rotation.sinAngle.value = Math.sin(angle);
+
+    /*  The shader writes to the vertex buffer itself, so there is nothing to *
+     *  upload. The rotation is queued before the draw that uses it.          */
+    renderer.compute(compute.rotate);
+    renderer.render(scene, camera);
+}
+/*  End of webgpuZRotate.                                                     */
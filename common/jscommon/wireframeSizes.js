@@ -0,0 +1,68 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Computes the sizes of the vertex and index buffers of a wireframe.    *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {
+    computeIndexSize,
+    MeshLayout,
+    MeshType,
+    RotationMode
+} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      wireframeSizes                                                        *
+ *  Purpose:                                                                  *
+ *      Computes the number of elements in the vertex and index buffers of a  *
+ *      wireframe, for any mesh type.                                         *
+ *  Arguments:                                                                *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters. Only nxPts, nyPts, and meshType are used,  *
+ *          meshType is SquareWireframe if it is not given.                   *
+ *  Output:                                                                   *
+ *      sizes (struct):                                                       *
+ *          The number of floats in the vertex buffer, meshSize, and the      *
+ *          number of indices in the index buffer, indexSize.                 *
+ *  Notes:                                                                    *
+ *      The number of line segments depends on how the edges of the grid are  *
+ *      glued, and on whether the squares have diagonals. It is computed by   *
+ *      compute_index_size, the same as for the canvas buffers.               *
+ ******************************************************************************/
+export function wireframeSizes(parameters) {
+
+    /*  embind needs every field of CanvasParameters. The layout and rotation *
+     *  mode do not change the sizes, any value will do.                      */
+    const canvasParameters = {
+        meshType: MeshType.SquareWireframe,
+        meshLayout: MeshLayout.InterleavedLayout,
+        rotationMode: RotationMode.IncrementalRotation,
+        ...parameters
+    };
+
+    return {
+        meshSize: 3 * parameters.nxPts * parameters.nyPts,
+        indexSize: computeIndexSize(canvasParameters)
+    };
+}
+/*  End of wireframeSizes.                                                    */
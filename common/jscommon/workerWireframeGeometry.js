@@ -0,0 +1,127 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Creates a wireframe geometry whose frames are computed in a worker.   *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {BufferAttribute, BufferGeometry} from "three";
+import {FrameHandoff} from "./frameHandoff.js";
+import {meshWorker} from "./meshWorker.js";
+import {wireframeSizes} from "./wireframeSizes.js";
+import {IndexType, MeshLayout, MeshType} from "wasmtools";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      workerWireframeGeometry                                               *
+ *  Purpose:                                                                  *
+ *      Creates a square wireframe that rotates about the z axis, with the    *
+ *      WebAssembly module running in a worker, one frame ahead of the main   *
+ *      thread.                                                               *
+ *  Arguments:                                                                *
+ *      parameters (struct):                                                  *
+ *          The canvas parameters: nxPts, nyPts, width, height, xStart,       *
+ *          yStart, and optionally meshType and meshLayout.                   *
+ *      rotationAngle (Number):                                               *
+ *          The angle of rotation between frames.                             *
+ *  Output:                                                                   *
+ *      geometry (Promise<BufferGeometry>):                                   *
+ *          The geometry, rendered with workerZRotate. The worker and the     *
+ *          shared buffers are stored in geometry.userData.pipeline.          *
+ *  Notes:                                                                    *
+ *      This requires the threaded build of the animation, listed as          *
+ *      main-pthread in the import map, and a cross-origin isolated page,     *
+ *      since the memory is shared. The worker is stopped with                *
+ *      geometry.userData.pipeline.worker.terminate().                        *
+ ******************************************************************************/
+export async function workerWireframeGeometry(parameters, rotationAngle) {
+
+    /*  Same sizes as in squareWireframeGeometry.                             */
+    const geometry = new BufferGeometry();
+    const {meshSize, indexSize} = wireframeSizes(parameters);
+
+    /*  Workers can not be created from a cross-origin script, and this file  *
+     *  is usually served from a CDN. Start the worker from a Blob instead.   */
+    const handoff = JSON.stringify(FrameHandoff);
+    const source = `(${meshWorker.toString()})(${handoff});`;
+    const blob = new Blob([source], {type: "text/javascript"});
+    const worker = new Worker(URL.createObjectURL(blob), {type: "module"});
+
+    /*  Import maps do not apply to workers, resolve the module here.         */
+    const moduleURL = import.meta.resolve("main-pthread");
+
+    /*  Shared between the two threads, see frameHandoff.js.                  */
+    const controlSize = FrameHandoff.length * Int32Array.BYTES_PER_ELEMENT;
+    const control = new Int32Array(new SharedArrayBuffer(controlSize));
+
+    /*  embind enums can not be sent to a worker, send their values instead.  */
+    const {
+        meshType = MeshType.SquareWireframe,
+        meshLayout = MeshLayout.InterleavedLayout
+    } = parameters;
+
+    const workerParameters = {
+        ...parameters,
+        meshType: meshType.value ?? meshType,
+        meshLayout: meshLayout.value ?? meshLayout
+    };
+
+    /*  The worker replies once the canvas is allocated and the first frame   *
+     *  has been computed.                                                    */
+    const reply = new Promise((resolve, reject) => {
+        worker.onmessage = (event) => resolve(event.data);
+        worker.onerror = reject;
+    });
+
+    worker.postMessage({
+        moduleURL: moduleURL,
+        parameters: workerParameters,
+        rotationAngle: rotationAngle,
+        control: control
+    });
+
+    const {buffer, outputs, indices, indexType} = await reply;
+
+    /*  Views for both output buffers are created once, the main thread only  *
+     *  swaps between them. The worker never allocates after replying, so the *
+     *  views remain valid even if the memory later grows.                    */
+    const frames = outputs.map(
+        (address) => new Float32Array(buffer, address, meshSize)
+    );
+
+    const IndexArray = indexType === IndexType.Uint16Indices.value ?
+        Uint16Array : Uint32Array;
+
+    const indexBuffer = new IndexArray(buffer, indices, indexSize);
+
+    geometry.setAttribute('position', new BufferAttribute(frames[0], 3));
+    geometry.setIndex(new BufferAttribute(indexBuffer, 1));
+    geometry.computeBoundingSphere();
+
+    geometry.userData.pipeline = {
+        worker: worker,
+        control: control,
+        frames: frames
+    };
+
+    return geometry;
+}
+/*  End of workerWireframeGeometry.                                           */
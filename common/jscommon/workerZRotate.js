@@ -0,0 +1,74 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Renders a frame computed by the worker for a geometry from            *
+ *      workerWireframeGeometry.                                              *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {FrameHandoff} from "./frameHandoff.js";
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      workerZRotate                                                         *
+ *  Purpose:                                                                  *
+ *      Renders the scene, flipping to the next frame of the rotation if the  *
+ *      worker has finished it.                                               *
+ *  Arguments:                                                                *
+ *      renderer (three.WebGLRenderer):                                       *
+ *          The renderer for the animation.                                   *
+ *      scene (three.Scene):                                                  *
+ *          The scene containing the surface.                                 *
+ *      camera (three.PerspectiveCamera):                                     *
+ *          The camera used for viewing the animation.                        *
+ *      surface (three.Object3D):                                             *
+ *          The object being rotated, with a geometry from                    *
+ *          workerWireframeGeometry.                                          *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      Unlike zRotate, no mesh is computed on the main thread. The only work *
+ *      here is pointing the position attribute at the buffer with the new    *
+ *      frame. If the worker is not done, the previous frame is drawn again.  *
+ ******************************************************************************/
+export function workerZRotate(renderer, scene, camera, surface) {
+
+    const pipeline = surface.geometry.userData.pipeline;
+    const control = pipeline.control;
+    const state = Atomics.load(control, FrameHandoff.stateIndex);
+
+    /*  Flip to the new frame if there is one, otherwise draw the same again. */
+    if (state === FrameHandoff.ready) {
+        const position = surface.geometry.attributes.position;
+        const buffer = Atomics.load(control, FrameHandoff.bufferIndex);
+
+        position.array = pipeline.frames[buffer];
+        position.needsUpdate = true;
+
+        /*  The worker now writes to the other buffer, which is not used by   *
+         *  this frame. Let it start on frame N + 1 while frame N renders.    */
+        Atomics.store(control, FrameHandoff.stateIndex, FrameHandoff.consumed);
+        Atomics.notify(control, FrameHandoff.stateIndex);
+    }
+
+    renderer.render(scene, camera);
+}
+/*  End of workerZRotate.                                                     */
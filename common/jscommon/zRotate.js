@@ -1,5 +1,5 @@
-import {initGeometry} from './initGeometry.js'
 import {zRotateCanvas, mainCanvasAddress} from 'wasmtools';
+import {checkMemoryViews} from "./memoryViews.js";
 
 /******************************************************************************
  *  Function:                                                                 *
@@ -13,23 +13,19 @@ import {zRotateCanvas, mainCanvasAddress} from 'wasmtools';
  ******************************************************************************/
 export function zRotate(renderer, scene, camera, surface, size) {
 
-    /*  Rotate the object slightly as time passes.                            */
-    const canvasPtr = mainCanvasAddress();
+    /*  Rotate the object slightly as time passes. Geometries created with    *
+     *  canvasWireframeGeometry carry their own canvas, the rest use the main *
+     *  one.                                                                  */
+    const canvasPtr = surface.geometry.userData.canvas ?? mainCanvasAddress();
     zRotateCanvas(canvasPtr);
 
-    /*  This problem seems to be unique to Go, C and rust do not have this    *
-     *  issue. It is possible for the address of the mesh and index buffers   *
-     *  to change on their own. It seems Go's garbage collector is at fault   *
-     *  here. If the address changes, we need to update the JavaScript        *
-     *  attributes to use the new locations.                                  */
-    if (surface.geometry.attributes.position.array.byteLength == 0) {
+    /*  Nothing here allocates, but other calls since the last frame may have *
+     *  grown the memory. Re-create the views if so, see memoryViews.js.      */
+    checkMemoryViews();
 
-        /*  Compute the number of elements in each buffer.                    */
-        const meshSize = 3 * size;
-        const indexSize = surface.geometry.index.count;
-
-        /*  Reset the geometry attributes to use the new addresses.           */
-        initGeometry(surface.geometry, meshSize, indexSize);
+    /*  The normals, if any, were rotated along with the mesh.                */
+    if (surface.geometry.attributes.normal) {
+        surface.geometry.attributes.normal.needsUpdate = true;
     }
 
     /*  Re-render the newly rotated scene.                                    */
@@ -0,0 +1,366 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Loads each of the implementations of the elliptic paraboloid for the  *
+ *      benchmarks.                                                           *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Parameters shared by every backend. The Go and Rust versions only allow   *
+ *  grids up to 512 x 512, which is the largest size that is benchmarked.     */
+const surfaceParameters = {
+    width: 2.0,
+    height: 2.0,
+    xStart: -1.0,
+    yStart: -1.0,
+    meshType: 0
+};
+
+/*  The angle of rotation between frames, the same as in the animation.       */
+const rotationAngle = 0.005;
+
+/*  Node has no fetch for local files, so check where this is running.        */
+const isNode = typeof process !== "undefined" && process.versions?.node;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      loadBytes                                                             *
+ *  Purpose:                                                                  *
+ *      Reads a file that is next to the animation, from disk in Node or with *
+ *      fetch in a browser.                                                   *
+ *  Arguments:                                                                *
+ *      path (String):                                                        *
+ *          The path of the file, relative to this directory.                 *
+ *  Output:                                                                   *
+ *      bytes (Promise<Uint8Array>):                                          *
+ *          The contents of the file, rejected if it does not exist.          *
+ ******************************************************************************/
+async function loadBytes(path) {
+
+    const url = new URL(path, import.meta.url);
+
+    if (isNode) {
+        const fs = await import("node:fs/promises");
+        return new Uint8Array(await fs.readFile(url));
+    }
+
+    const response = await fetch(url);
+
+    if (!response.ok) {
+        throw new Error(`could not fetch ${url}`);
+    }
+
+    return new Uint8Array(await response.arrayBuffer());
+}
+/*  End of loadBytes.                                                         */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      moduleSize                                                            *
+ *  Purpose:                                                                  *
+ *      Computes the total size of the files that make up a backend.          *
+ *  Arguments:                                                                *
+ *      files (Array<String>):                                                *
+ *          The paths of the files, relative to this directory.               *
+ *  Output:                                                                   *
+ *      size (Promise<Number>):                                               *
+ *          The total number of bytes.                                        *
+ *  Notes:                                                                    *
+ *      This is the size before compression, servers usually send these       *
+ *      gzipped.                                                              *
+ ******************************************************************************/
+export async function moduleSize(files) {
+    const sizes = await Promise.all(
+        files.map(async (file) => (await loadBytes(file)).byteLength)
+    );
+
+    return sizes.reduce((total, size) => total + size, 0);
+}
+/*  End of moduleSize.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      emscriptenBackend                                                     *
+ *  Purpose:                                                                  *
+ *      Creates a backend for one of the emscripten builds of the C version.  *
+ *  Arguments:                                                                *
+ *      name (String):                                                        *
+ *          The name used in the report.                                      *
+ *      script (String):                                                      *
+ *          The JavaScript file generated by emscripten.                      *
+ *      wasm (String):                                                        *
+ *          The WebAssembly file generated by emscripten.                     *
+ *  Output:                                                                   *
+ *      backend (Object):                                                     *
+ *          The backend, see the notes in benchmark.js.                       *
+ *  Notes:                                                                    *
+ *      Each grid size gets its own canvas, destroyed by close. The index     *
+ *      buffer is cached by setupCanvasMesh, so mesh only recomputes the      *
+ *      vertices, and indices recomputes the line segments with               *
+ *      generateWireframe.                                                    *
+ ******************************************************************************/
+function emscriptenBackend(name, script, wasm) {
+    return {
+        name: name,
+        files: [script, wasm],
+
+        async load() {
+            const url = new URL(script, import.meta.url);
+            const initModule = (await import(url.href)).default;
+            const module = await initModule();
+            let canvas = 0;
+
+            return {
+                setup(nxPts, nyPts) {
+                    if (canvas) {
+                        module.destroyCanvas(canvas);
+                    }
+
+                    canvas = module.createCanvas({
+                        ...surfaceParameters,
+                        nxPts: nxPts,
+                        nyPts: nyPts,
+                        meshType: module.MeshType.SquareWireframe,
+                        meshLayout: module.MeshLayout.InterleavedLayout,
+                        rotationMode: module.RotationMode.IncrementalRotation
+                    });
+
+                    module.setupCanvasMesh(canvas);
+                    module.setRotationAngle(rotationAngle);
+                },
+
+                mesh() {
+                    module.setupCanvasMesh(canvas);
+                },
+
+                indices() {
+                    module.generateWireframe(canvas);
+                },
+
+                frame() {
+                    module.zRotateCanvas(canvas);
+                },
+
+                close() {
+                    module.destroyCanvas(canvas);
+                    canvas = 0;
+                }
+            };
+        }
+    };
+}
+/*  End of emscriptenBackend.                                                 */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      rustBackend                                                           *
+ *  Purpose:                                                                  *
+ *      Creates a backend for the Rust version, built with wasm-pack.         *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      backend (Object):                                                     *
+ *          The backend, see the notes in benchmark.js.                       *
+ *  Notes:                                                                    *
+ *      The Rust version works on fixed buffers in its own memory, sized for  *
+ *      the largest grid.                                                     *
+ ******************************************************************************/
+function rustBackend() {
+    return {
+        name: "rust",
+        files: ["../pkg/paraboloid.js", "../pkg/paraboloid_bg.wasm"],
+
+        async load() {
+            const url = new URL("../pkg/paraboloid.js", import.meta.url);
+            const rust = await import(url.href);
+            const bytes = await loadBytes("../pkg/paraboloid_bg.wasm");
+            await rust.default({module_or_path: bytes});
+
+            const meshPtr = rust.getMeshBuffer();
+            const indexPtr = rust.getIndexBuffer();
+            let nx = 0, ny = 0;
+
+            return {
+                setup(nxPts, nyPts) {
+                    nx = nxPts;
+                    ny = nyPts;
+                    rust.setRotationAngle(rotationAngle);
+                    rust.generateMesh(meshPtr, nx, ny);
+                    rust.generateIndices(indexPtr, nx, ny);
+                },
+
+                mesh() {
+                    rust.generateMesh(meshPtr, nx, ny);
+                },
+
+                indices() {
+                    rust.generateIndices(indexPtr, nx, ny);
+                },
+
+                frame() {
+                    rust.rotateMesh(meshPtr, nx * ny);
+                },
+
+                close() {
+                    /*  The buffers are static, there is nothing to free.     */
+                }
+            };
+        }
+    };
+}
+/*  End of rustBackend.                                                       */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      goBackend                                                             *
+ *  Purpose:                                                                  *
+ *      Creates a backend for the Go version.                                 *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      backend (Object):                                                     *
+ *          The backend, see the notes in benchmark.js.                       *
+ *  Notes:                                                                    *
+ *      The Go version only has setupMesh, which computes the vertices and the*
+ *      line segments together, so it has no separate mesh and indices phases.*
+ *      Its functions are set on the global object, as in                     *
+ *      common/gosrc/jstools/index.js. The glue code, wasm_exec.js, is copied *
+ *      from the Go toolchain by make bench, since it must match the compiler.*
+ *      The module keeps running until the page, or Node, exits.              *
+ ******************************************************************************/
+function goBackend() {
+    return {
+        name: "go",
+        files: ["wasm_exec.js", "main_go.wasm"],
+
+        async load() {
+            const bytes = await loadBytes("main_go.wasm");
+            await import("./wasm_exec.js");
+
+            const go = new globalThis.Go();
+            const imports = go.importObject;
+            const result = await WebAssembly.instantiate(bytes, imports);
+            go.run(result.instance);
+
+            return {
+                setup(nxPts, nyPts) {
+                    globalThis.setupMesh({
+                        ...surfaceParameters,
+                        nxPts: nxPts,
+                        nyPts: nyPts
+                    });
+
+                    globalThis.setRotationAngle(rotationAngle);
+                },
+
+                frame() {
+                    globalThis.zRotateMainCanvas();
+                },
+
+                close() {
+                    /*  The Go buffers are static, there is nothing to free.  */
+                }
+            };
+        }
+    };
+}
+/*  End of goBackend.                                                         */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      jsBackend                                                             *
+ *  Purpose:                                                                  *
+ *      Creates a backend for the plain JavaScript version.                   *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      backend (Object):                                                     *
+ *          The backend, see the notes in benchmark.js.                       *
+ *  Notes:                                                                    *
+ *      The size is that of the files the animation needs, there is no        *
+ *      WebAssembly.                                                          *
+ ******************************************************************************/
+function jsBackend() {
+    return {
+        name: "js",
+        files: [
+            "../jssrc/generateIndices.js",
+            "../jssrc/generateMesh.js",
+            "../jssrc/rotateMesh.js",
+            "../jssrc/setRotationAngle.js"
+        ],
+
+        async load() {
+            const [
+                {generateIndices},
+                {generateMesh},
+                {rotateMesh},
+                {setRotationAngle}
+            ] = await Promise.all(this.files.map((file) => import(file)));
+
+            let mesh, indices, nx = 0, ny = 0;
+
+            return {
+                setup(nxPts, nyPts) {
+                    const numberOfPoints = nxPts * nyPts;
+                    const indexSize = 2 * (2 * numberOfPoints - nxPts - nyPts);
+
+                    nx = nxPts;
+                    ny = nyPts;
+                    mesh = new Float32Array(3 * numberOfPoints);
+                    indices = new Uint32Array(indexSize);
+
+                    setRotationAngle(rotationAngle);
+                    generateMesh(mesh, nx, ny);
+                    generateIndices(indices, nx, ny);
+                },
+
+                mesh() {
+                    generateMesh(mesh, nx, ny);
+                },
+
+                indices() {
+                    generateIndices(indices, nx, ny);
+                },
+
+                frame() {
+                    rotateMesh(mesh, nx * ny);
+                },
+
+                close() {
+                    mesh = undefined;
+                    indices = undefined;
+                }
+            };
+        }
+    };
+}
+/*  End of jsBackend.                                                         */
+
+/*  Every backend, in the order they are reported. The pthread build is left  *
+ *  out since it needs a cross-origin isolated page and a worker pool.        */
+export const backends = [
+    emscriptenBackend("c", "../main.js", "../main.wasm"),
+    emscriptenBackend("c-simd", "../main_simd.js", "../main_simd.wasm"),
+    rustBackend(),
+    goBackend(),
+    jsBackend()
+];
@@ -0,0 +1,224 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Times mesh generation, index generation, and rotations for a backend. *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Square grids from 16 x 16 to 512 x 512, the largest the Go and Rust       *
+ *  versions allow.                                                           */
+export const gridSizes = [16, 32, 64, 128, 256, 512];
+
+/*  Untimed runs before each measurement, so the JIT and caches settle.       */
+const warmupRuns = 5;
+
+/*  Timed runs of the mesh and index generation for each grid.                */
+const setupRuns = 50;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      percentile                                                            *
+ *  Purpose:                                                                  *
+ *      Returns a percentile of a sorted list of times, using the nearest     *
+ *      rank.                                                                 *
+ *  Arguments:                                                                *
+ *      sorted (Array<Number>):                                               *
+ *          The times, in increasing order.                                   *
+ *      fraction (Number):                                                    *
+ *          The percentile as a number between 0 and 1, like 0.99.            *
+ *  Output:                                                                   *
+ *      value (Number):                                                       *
+ *          The smallest time that at least this fraction of the list is less *
+ *          than or equal to.                                                 *
+ ******************************************************************************/
+function percentile(sorted, fraction) {
+    const rank = Math.ceil(fraction * sorted.length);
+    return sorted[Math.max(rank - 1, 0)];
+}
+/*  End of percentile.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      timeRuns                                                              *
+ *  Purpose:                                                                  *
+ *      Calls a function repeatedly, timing each call.                        *
+ *  Arguments:                                                                *
+ *      run (Function):                                                       *
+ *          The function being timed, with no arguments.                      *
+ *      count (Number):                                                       *
+ *          The number of timed calls.                                        *
+ *  Output:                                                                   *
+ *      times (Array<Number>):                                                *
+ *          The time of each call in milliseconds, sorted.                    *
+ *  Notes:                                                                    *
+ *      Each call is timed on its own, which is what a frame of the animation *
+ *      does. The browser may round performance.now to as much as 0.1         *
+ *      milliseconds, Node does not, so the smallest grids are best measured  *
+ *      in Node.                                                              *
+ ******************************************************************************/
+function timeRuns(run, count) {
+
+    for (let index = 0; index < warmupRuns; ++index) {
+        run();
+    }
+
+    const times = new Array(count);
+
+    for (let index = 0; index < count; ++index) {
+        const start = performance.now();
+        run();
+        times[index] = performance.now() - start;
+    }
+
+    return times.sort((a, b) => a - b);
+}
+/*  End of timeRuns.                                                          */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      summarize                                                             *
+ *  Purpose:                                                                  *
+ *      Reduces the times for one phase to the numbers in the report.         *
+ *  Arguments:                                                                *
+ *      times (Array<Number>):                                                *
+ *          The sorted times, in milliseconds.                                *
+ *      points (Number):                                                      *
+ *          The number of points processed by each call.                      *
+ *  Output:                                                                   *
+ *      summary (Object):                                                     *
+ *          The median and 99th percentile in milliseconds, and the throughput*
+ *          in points per second at the median.                               *
+ ******************************************************************************/
+function summarize(times, points) {
+    const p50 = percentile(times, 0.5);
+
+    return {
+        p50: p50,
+        p99: percentile(times, 0.99),
+        pointsPerSecond: p50 > 0.0 ? 1.0E3 * points / p50 : Infinity
+    };
+}
+/*  End of summarize.                                                         */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      runBackend                                                            *
+ *  Purpose:                                                                  *
+ *      Benchmarks every phase of one backend over all of the grid sizes.     *
+ *  Arguments:                                                                *
+ *      backend (Object):                                                     *
+ *          A backend from backends.js.                                       *
+ *      frames (Number):                                                      *
+ *          The number of rotation frames timed for each grid.                *
+ *  Output:                                                                   *
+ *      results (Promise<Array<Object>>):                                     *
+ *          One entry per grid size and phase, with the backend, the grid, the*
+ *          phase, and its summary.                                           *
+ *  Notes:                                                                    *
+ *      A backend has a name, the files that make it up, and a load function. *
+ *      load resolves to an object with setup(nxPts, nyPts), frame(), close(),*
+ *      and optionally mesh() and indices(). setup computes the mesh and the  *
+ *      line segments for a new grid, since this is what an animation does    *
+ *      when it starts, and is timed as the setup phase. Backends without mesh*
+ *      or indices only report the setup and frame phases.                    *
+ ******************************************************************************/
+export async function runBackend(backend, frames) {
+
+    const instance = await backend.load();
+    const results = [];
+
+    for (const size of gridSizes) {
+        const points = size * size;
+
+        /*  The phases run in this order, on the grid from the last setup.    */
+        const phases = {
+            setup: () => instance.setup(size, size),
+            mesh: instance.mesh?.bind(instance),
+            indices: instance.indices?.bind(instance),
+            frame: instance.frame.bind(instance)
+        };
+
+        instance.setup(size, size);
+
+        for (const [phase, run] of Object.entries(phases)) {
+            if (!run) {
+                continue;
+            }
+
+            const count = phase === "frame" ? frames : setupRuns;
+            const times = timeRuns(run, count);
+
+            results.push({
+                backend: backend.name,
+                size: size,
+                phase: phase,
+                ...summarize(times, points)
+            });
+        }
+
+        instance.close();
+    }
+
+    return results;
+}
+/*  End of runBackend.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      formatReport                                                          *
+ *  Purpose:                                                                  *
+ *      Writes the results as a plain text table.                             *
+ *  Arguments:                                                                *
+ *      results (Array<Object>):                                              *
+ *          The entries from runBackend, for every backend.                   *
+ *      sizes (Object):                                                       *
+ *          The module size in bytes of each backend, by name.                *
+ *  Output:                                                                   *
+ *      report (String):                                                      *
+ *          The table, one line per grid size and phase.                      *
+ ******************************************************************************/
+export function formatReport(results, sizes) {
+
+    const header = [
+        "backend".padEnd(8),
+        "grid".padStart(8),
+        "phase".padStart(8),
+        "p50 ms".padStart(10),
+        "p99 ms".padStart(10),
+        "Mpts/s".padStart(10)
+    ].join(" ");
+
+    const rows = results.map((result) => [
+        result.backend.padEnd(8),
+        `${result.size}x${result.size}`.padStart(8),
+        result.phase.padStart(8),
+        result.p50.toFixed(4).padStart(10),
+        result.p99.toFixed(4).padStart(10),
+        (1.0E-6 * result.pointsPerSecond).toFixed(1).padStart(10)
+    ].join(" "));
+
+    const moduleSizes = Object.entries(sizes).map(
+        ([name, size]) => `${name.padEnd(8)} ${(size / 1024).toFixed(1)} KiB`
+    );
+
+    return [header, ...rows, "", "module size", ...moduleSizes].join("\n");
+}
+/*  End of formatReport.                                                      */
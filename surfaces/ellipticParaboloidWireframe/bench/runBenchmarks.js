@@ -0,0 +1,114 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is part of threejs_figures.                                     *
+ *                                                                            *
+ *  threejs_figures is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  threejs_figures is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with threejs_figures.  If not, see <https://www.gnu.org/licenses/>. *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Runs the benchmarks for every backend that has been built, in Node or *
+ *      in a browser.                                                         *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+import {backends, moduleSize} from "./backends.js";
+import {formatReport, runBackend} from "./benchmark.js";
+
+/*  The number of rotation frames timed for each grid. Set with the first     *
+ *  argument in Node, or with ?frames=N in a browser.                         */
+const defaultFrames = 1000;
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      frameCount                                                            *
+ *  Purpose:                                                                  *
+ *      Reads the number of rotation frames to time from the command line or  *
+ *      the URL.                                                              *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      frames (Number):                                                      *
+ *          The number of frames, defaultFrames if none was given.            *
+ ******************************************************************************/
+function frameCount() {
+
+    const argument = typeof process !== "undefined" ?
+        process.argv[2] :
+        new URLSearchParams(location.search).get("frames");
+
+    const frames = Number.parseInt(argument ?? "", 10);
+    return Number.isFinite(frames) && frames > 0 ? frames : defaultFrames;
+}
+/*  End of frameCount.                                                        */
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      runBenchmarks                                                         *
+ *  Purpose:                                                                  *
+ *      Benchmarks each backend in turn and prints the report.                *
+ *  Arguments:                                                                *
+ *      None (void).                                                          *
+ *  Output:                                                                   *
+ *      report (Promise<String>):                                             *
+ *          The report, also written to the console.                          *
+ *  Notes:                                                                    *
+ *      Backends that have not been built are skipped with a message, so make *
+ *      bench does not need every toolchain. In a browser the report is also  *
+ *      written to the element with id report, if there is one.               *
+ ******************************************************************************/
+async function runBenchmarks() {
+
+    const frames = frameCount();
+    const results = [];
+    const sizes = {};
+
+    for (const backend of backends) {
+        try {
+            sizes[backend.name] = await moduleSize(backend.files);
+        } catch {
+            console.log(`${backend.name}: not built, skipping`);
+            continue;
+        }
+
+        /*  A build left over from an older version of threetools may lack    *
+         *  some of the functions. Report it and carry on with the rest.      */
+        try {
+            results.push(...await runBackend(backend, frames));
+        } catch (error) {
+            console.log(`${backend.name}: failed, ${error.message}`);
+            delete sizes[backend.name];
+        }
+    }
+
+    const report = formatReport(results, sizes);
+    console.log(report);
+
+    const output = globalThis.document?.getElementById("report");
+
+    if (output) {
+        output.textContent = report;
+    }
+
+    return report;
+}
+/*  End of runBenchmarks.                                                     */
+
+/*  The Go module never exits on its own, so Node is told to once done.       */
+await runBenchmarks();
+
+if (typeof process !== "undefined") {
+    process.exit(0);
+}
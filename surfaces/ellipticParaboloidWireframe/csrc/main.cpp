@@ -20,31 +20,86 @@
  *  Author:     Ryan Maguire                                                  *
  *  Date:       November 19, 2025                                             *
  ******************************************************************************/
-#include <threetools/threetools.h>
+#include <threetools/threetools.hpp>
 #include <emscripten/bind.h>
 
-/*  Height shift for centering the mesh when it is rendered on the screen.    */
-static const float surface_height_shift = -2.0F;
+/*  elliptic_paraboloid provided here, it is also built as a side module.     */
+#include "surface.h"
 
-/*  The surface being rendered, an elliptic paraboloid.                       */
-static float surface(float x, float y)
+/*  The surface being rendered, an elliptic paraboloid. This is a lambda so   *
+ *  that the templates in threetools.hpp inline it into the mesh loop.        */
+static const auto surface = [](float x, float y) -> float
 {
-    /*  An elliptic paraboloid has the formula z = x^2 + a y^2, with a > 1.   *
-     *  We use the height shift to center the object on the screen.           */
-    return x*x + 2.0F * y*y + surface_height_shift;
-}
+    return elliptic_paraboloid(x, y);
+};
 /*  End of surface.                                                           */
 
-/*  Wrapper for the Go function MakeRectangularWireframe.                     */
-static void setup_mesh(CanvasParameters parameters)
+/*  Wrapper for the Go function MakeRectangularWireframe. Returns true if the *
+ *  index buffer changed and needs to be uploaded again.                      */
+static bool setup_mesh(CanvasParameters parameters)
 {
-    make_rectangular_wireframe(&parameters, surface);
+    return threetools::make_rectangular_wireframe(&parameters, surface) != 0U;
 }
 /*  End of setupMesh.                                                         */
 
+/*  Same as setup_mesh, but for a canvas created with createCanvas.           */
+static bool setup_canvas_mesh(const uintptr_t ptr)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    return threetools::generate_canvas_wireframe(canvas, surface) != 0U;
+}
+/*  End of setup_canvas_mesh.                                                 */
+
+/*  Updates a canvas for new parameters, only recomputing what changed.       */
+static CanvasUpdate
+update_canvas_mesh(const uintptr_t ptr, CanvasParameters parameters)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    return threetools::update_canvas(canvas, &parameters, surface);
+}
+/*  End of update_canvas_mesh.                                                */
+
+/*  Computes the next band of rows of a canvas, for progressive rendering.    */
+static CanvasBand
+generate_canvas_mesh_band(const uintptr_t ptr,
+                          unsigned int first_row,
+                          unsigned int rows)
+{
+    Canvas * const canvas = reinterpret_cast<Canvas * const>(ptr);
+    return threetools::generate_canvas_band(canvas, first_row, rows, surface);
+}
+/*  End of generate_canvas_mesh_band.                                         */
+
+/*  Same as setup_canvas_mesh, for every level of a pyramid.                  */
+static bool setup_pyramid_mesh(const uintptr_t ptr)
+{
+    CanvasPyramid * const pyramid =
+        reinterpret_cast<CanvasPyramid * const>(ptr);
+
+    return threetools::generate_canvas_pyramid(pyramid, surface) != 0U;
+}
+/*  End of setup_pyramid_mesh.                                                */
+
+/*  Same as update_canvas_mesh, for every level of a pyramid. Returns true if *
+ *  the views into any level need to be re-created.                           */
+static bool
+update_pyramid_mesh(const uintptr_t ptr, CanvasParameters parameters)
+{
+    CanvasPyramid * const pyramid =
+        reinterpret_cast<CanvasPyramid * const>(ptr);
+
+    return threetools::update_canvas_pyramid(pyramid, &parameters, surface);
+}
+/*  End of update_pyramid_mesh.                                               */
+
 /*  Main program, start of the JavaScript animation.                          */
 EMSCRIPTEN_BINDINGS(threetools)
 {
     emscripten::function("setupMesh", &setup_mesh);
+    emscripten::function("setupCanvasMesh", &setup_canvas_mesh);
+    emscripten::function("updateCanvasMesh", &update_canvas_mesh);
+    emscripten::function("generateCanvasBand", &generate_canvas_mesh_band);
+    emscripten::function("setupPyramidMesh", &setup_pyramid_mesh);
+    emscripten::function("updatePyramidMesh", &update_pyramid_mesh);
 }
 /*  End of main.                                                              */
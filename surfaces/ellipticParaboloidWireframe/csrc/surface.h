@@ -0,0 +1,40 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      The elliptic paraboloid, shared by main.cpp and the side module.      *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 14, 2026                                              *
+ ******************************************************************************/
+
+/*  Include guard to prevent including this file twice.                       */
+#ifndef ELLIPTIC_PARABOLOID_SURFACE_H
+#define ELLIPTIC_PARABOLOID_SURFACE_H
+
+/*  Height shift for centering the mesh when it is rendered on the screen.    */
+#define SURFACE_HEIGHT_SHIFT (-2.0F)
+
+/*  An elliptic paraboloid has the formula z = x^2 + a y^2, with a > 1. We    *
+ *  use the height shift to center the object on the screen.                  */
+static inline float elliptic_paraboloid(float x, float y)
+{
+    return x*x + 2.0F * y*y + SURFACE_HEIGHT_SHIFT;
+}
+/*  End of elliptic_paraboloid.                                               */
+
+#endif
+/*  End of include guard.                                                     */
@@ -0,0 +1,116 @@
+/******************************************************************************
+ *                                  LICENSE                                   *
+ ******************************************************************************
+ *  This file is free software: you can redistribute it and/or modify         *
+ *  it under the terms of the GNU General Public License as published by      *
+ *  the Free Software Foundation, either version 3 of the License, or         *
+ *  (at your option) any later version.                                       *
+ *                                                                            *
+ *  This file is distributed in the hope that it will be useful,              *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ *  GNU General Public License for more details.                              *
+ *                                                                            *
+ *  You should have received a copy of the GNU General Public License         *
+ *  along with this file.  If not, see <https://www.gnu.org/licenses/>.       *
+ ******************************************************************************
+ *  Purpose:                                                                  *
+ *      Renders an elliptic paraboloid, z = x^2 + 2y^2, with the mesh and the *
+ *      rotation computed by WebGPU compute shaders.                          *
+ ******************************************************************************
+ *  Author:     Ryan Maguire                                                  *
+ *  Date:       October 15, 2026                                              *
+ ******************************************************************************/
+
+/* JavaScript module using WebAssembly compiled from C code using emscripten. */
+import * as threetools from "threetools";
+
+/*  The WebGPU functions, bundled separately from the rest of threetools.     */
+import * as webgpu from "threetools-webgpu";
+
+/*  The surface in TSL. This is elliptic_paraboloid from csrc/surface.h, the  *
+ *  same shift included, so that main.wasm can be used as the fallback.       */
+function ellipticParaboloid(x, y) {
+    return x.mul(x).add(y.mul(y).mul(2.0)).sub(2.0);
+}
+
+/******************************************************************************
+ *  Function:                                                                 *
+ *      init                                                                  *
+ *  Purpose:                                                                  *
+ *      Creates the animation for the wireframe elliptic paraboloid.          *
+ *  Arguments:                                                                *
+ *      None.                                                                 *
+ *  Output:                                                                   *
+ *      None.                                                                 *
+ *  Notes:                                                                    *
+ *      With ?check in the URL the compute shaders are first compared with    *
+ *      main.wasm, and the result is written to the console.                  *
+ ******************************************************************************/
+async function init() {
+
+    const parameters = {
+        nxPts: 64,
+        nyPts: 64,
+        width: 2.0,
+        height: 2.0,
+        xStart: -1.0,
+        yStart: -1.0,
+        meshType: 0
+    };
+
+    /*  The angle of rotation between frames.                                 */
+    const rotationAngle = 0.005;
+
+    const cameraPosition = {x: 0.0, y: -5.0, z: +6.0};
+
+    /*  WebGL, and the WebAssembly kernels, are used if WebGPU is missing.    */
+    const renderer = await webgpu.webgpuSceneRenderer(window);
+
+    /*  The check sets up the main canvas, so it runs before the geometry.    */
+    if (new URLSearchParams(location.search).has("check")) {
+        const result = await webgpu.webgpuComputeCheck(
+            renderer, parameters, ellipticParaboloid
+        );
+
+        console.log("webgpuComputeCheck:", result ?? "WebGPU unavailable");
+    }
+
+    /*  Initialize the globals for the animation. This includes the renderer, *
+     *  camera, objects, and scene.                                           */
+    const lightBlue = {color: 0x00AAFF};
+    const geometry = webgpu.webgpuWireframeGeometry(
+        renderer, parameters, ellipticParaboloid
+    );
+
+    const camera = threetools.sceneCamera(window, cameraPosition);
+    const surface = threetools.basicWireframe(geometry, lightBlue);
+    const scene = threetools.sceneFromSurface(surface);
+    const stats = new threetools.Stats();
+
+    function animation() {
+        webgpu.webgpuZRotate(renderer, scene, camera, surface, rotationAngle);
+        stats.update();
+    }
+
+    function onWindowResize () {
+        threetools.windowResize(camera, renderer, window);
+    }
+
+    renderer.setAnimationLoop(animation);
+
+    /*  Make the animation interactive. The user can click and drag the       *
+     *  drawing around using their mouse.                                     */
+    threetools.setupControls(renderer, camera);
+
+    /*  Attach the drawing to the actual page.                                */
+    document.body.appendChild(renderer.domElement);
+    document.body.appendChild(stats.dom);
+
+    /*  When the window is resized, update the necessary parameters.          */
+    window.addEventListener('resize', onWindowResize);
+}
+/*  End of init.                                                              */
+
+/*  Create the animation.                                                     */
+init();